@@ -0,0 +1,1469 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::ADC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_ADC_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_ADC_H
+
+#include <cstdint>
+#include <limits>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/peripheral/adc.h"
+#include "picolibrary/microchip/megaavr0/peripheral/evsys.h"
+#include "picolibrary/microchip/megaavr0/ring_buffer.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Microchip megaAVR 0-series ADC facilities.
+ */
+namespace picolibrary::Microchip::megaAVR0::ADC {
+
+/**
+ * \brief ADC sample.
+ */
+using Sample = std::uint16_t;
+
+/**
+ * \brief ADC reference.
+ */
+enum class ADC_Reference : std::uint8_t {
+    INTERNAL = Peripheral::ADC::CTRLC::REFSEL_INTERNAL, ///< Internal reference (VREF peripheral).
+    VDD      = Peripheral::ADC::CTRLC::REFSEL_VDD,      ///< VDD.
+    VREFA    = Peripheral::ADC::CTRLC::REFSEL_VREFA,    ///< External reference (VREFA pin).
+};
+
+/**
+ * \brief ADC sampling capacitance.
+ */
+enum class ADC_Sampling_Capacitance : std::uint8_t {
+    FULL    = 0b0 << Peripheral::ADC::CTRLC::Bit::SAMPCAP, ///< Full (recommended for references below 1 V).
+    REDUCED = 0b1 << Peripheral::ADC::CTRLC::Bit::SAMPCAP, ///< Reduced (recommended for references of 1 V and above).
+};
+
+/**
+ * \brief ADC clock prescaler.
+ */
+enum class ADC_Clock_Prescaler : std::uint8_t {
+    CLK_PER_2   = Peripheral::ADC::CTRLC::PRESC_DIV2,   ///< Peripheral clock frequency / 2.
+    CLK_PER_4   = Peripheral::ADC::CTRLC::PRESC_DIV4,   ///< Peripheral clock frequency / 4.
+    CLK_PER_8   = Peripheral::ADC::CTRLC::PRESC_DIV8,   ///< Peripheral clock frequency / 8.
+    CLK_PER_16  = Peripheral::ADC::CTRLC::PRESC_DIV16,  ///< Peripheral clock frequency / 16.
+    CLK_PER_32  = Peripheral::ADC::CTRLC::PRESC_DIV32,  ///< Peripheral clock frequency / 32.
+    CLK_PER_64  = Peripheral::ADC::CTRLC::PRESC_DIV64,  ///< Peripheral clock frequency / 64.
+    CLK_PER_128 = Peripheral::ADC::CTRLC::PRESC_DIV128, ///< Peripheral clock frequency / 128.
+    CLK_PER_256 = Peripheral::ADC::CTRLC::PRESC_DIV256, ///< Peripheral clock frequency / 256.
+};
+
+/**
+ * \brief ADC resolution.
+ */
+enum class ADC_Resolution : std::uint8_t {
+    _10_BIT = 0b0 << Peripheral::ADC::CTRLA::Bit::RESSEL, ///< 10-bit.
+    _8_BIT  = 0b1 << Peripheral::ADC::CTRLA::Bit::RESSEL, ///< 8-bit.
+};
+
+/**
+ * \brief ADC accumulation (number of conversions accumulated in hardware into a single
+ *        result).
+ */
+enum class ADC_Accumulation : std::uint8_t {
+    NONE = Peripheral::ADC::CTRLB::SAMPNUM_NONE,  ///< No accumulation.
+    _2   = Peripheral::ADC::CTRLB::SAMPNUM_ACC2,  ///< 2 conversions accumulated.
+    _4   = Peripheral::ADC::CTRLB::SAMPNUM_ACC4,  ///< 4 conversions accumulated.
+    _8   = Peripheral::ADC::CTRLB::SAMPNUM_ACC8,  ///< 8 conversions accumulated.
+    _16  = Peripheral::ADC::CTRLB::SAMPNUM_ACC16, ///< 16 conversions accumulated.
+    _32  = Peripheral::ADC::CTRLB::SAMPNUM_ACC32, ///< 32 conversions accumulated.
+    _64  = Peripheral::ADC::CTRLB::SAMPNUM_ACC64, ///< 64 conversions accumulated.
+};
+
+/**
+ * \brief ADC input.
+ *
+ * \attention The analog input pins that are available depend on the device's package.
+ */
+enum class ADC_Input : std::uint8_t {
+    AIN0      = Peripheral::ADC::MUXPOS::MUXPOS_AIN0,      ///< Analog input pin 0.
+    AIN1      = Peripheral::ADC::MUXPOS::MUXPOS_AIN1,      ///< Analog input pin 1.
+    AIN2      = Peripheral::ADC::MUXPOS::MUXPOS_AIN2,      ///< Analog input pin 2.
+    AIN3      = Peripheral::ADC::MUXPOS::MUXPOS_AIN3,      ///< Analog input pin 3.
+    AIN4      = Peripheral::ADC::MUXPOS::MUXPOS_AIN4,      ///< Analog input pin 4.
+    AIN5      = Peripheral::ADC::MUXPOS::MUXPOS_AIN5,      ///< Analog input pin 5.
+    AIN6      = Peripheral::ADC::MUXPOS::MUXPOS_AIN6,      ///< Analog input pin 6.
+    AIN7      = Peripheral::ADC::MUXPOS::MUXPOS_AIN7,      ///< Analog input pin 7.
+    AIN8      = Peripheral::ADC::MUXPOS::MUXPOS_AIN8,      ///< Analog input pin 8.
+    AIN9      = Peripheral::ADC::MUXPOS::MUXPOS_AIN9,      ///< Analog input pin 9.
+    AIN10     = Peripheral::ADC::MUXPOS::MUXPOS_AIN10,     ///< Analog input pin 10.
+    AIN11     = Peripheral::ADC::MUXPOS::MUXPOS_AIN11,     ///< Analog input pin 11.
+    AIN12     = Peripheral::ADC::MUXPOS::MUXPOS_AIN12,     ///< Analog input pin 12.
+    AIN13     = Peripheral::ADC::MUXPOS::MUXPOS_AIN13,     ///< Analog input pin 13.
+    AIN14     = Peripheral::ADC::MUXPOS::MUXPOS_AIN14,     ///< Analog input pin 14.
+    AIN15     = Peripheral::ADC::MUXPOS::MUXPOS_AIN15,     ///< Analog input pin 15.
+    DACREF0   = Peripheral::ADC::MUXPOS::MUXPOS_DACREF0,   ///< AC0 DAC reference.
+    TEMPSENSE = Peripheral::ADC::MUXPOS::MUXPOS_TEMPSENSE, ///< Temperature sensor.
+    GND       = Peripheral::ADC::MUXPOS::MUXPOS_GND,       ///< GND.
+};
+
+/**
+ * \brief ADC window comparison mode.
+ */
+enum class ADC_Window_Mode : std::uint8_t {
+    BELOW   = Peripheral::ADC::CTRLE::WINCM_BELOW,   ///< Result below the low threshold.
+    ABOVE   = Peripheral::ADC::CTRLE::WINCM_ABOVE,   ///< Result above the high threshold.
+    INSIDE  = Peripheral::ADC::CTRLE::WINCM_INSIDE,  ///< Result between the thresholds.
+    OUTSIDE = Peripheral::ADC::CTRLE::WINCM_OUTSIDE, ///< Result not between the thresholds.
+};
+
+/**
+ * \brief The maximum ADC sample length (SAMPCTRL register SAMPLEN field value).
+ */
+constexpr auto ADC_SAMPLE_LENGTH_MAX = std::uint8_t{ Peripheral::ADC::SAMPCTRL::Mask::SAMPLEN
+                                                     >> Peripheral::ADC::SAMPCTRL::Bit::SAMPLEN };
+
+/**
+ * \brief Get the divisor of an ADC clock prescaler.
+ *
+ * \param[in] adc_clock_prescaler The ADC clock prescaler.
+ *
+ * \return The divisor of the ADC clock prescaler.
+ */
+constexpr auto divisor( ADC_Clock_Prescaler adc_clock_prescaler ) noexcept -> std::uint16_t
+{
+    return std::uint16_t{ 2 } << ( to_underlying( adc_clock_prescaler ) >> Peripheral::ADC::CTRLC::Bit::PRESC );
+}
+
+/**
+ * \brief Get the number of bits in an ADC resolution.
+ *
+ * \param[in] adc_resolution The ADC resolution.
+ *
+ * \return The number of bits in the ADC resolution.
+ */
+constexpr auto bits( ADC_Resolution adc_resolution ) noexcept -> std::uint_fast8_t
+{
+    return adc_resolution == ADC_Resolution::_8_BIT ? 8 : 10;
+}
+
+/**
+ * \brief Get the base 2 logarithm of the number of conversions accumulated into a single
+ *        result.
+ *
+ * \param[in] adc_accumulation The ADC accumulation.
+ *
+ * \return The base 2 logarithm of the number of conversions accumulated into a single
+ *         result.
+ */
+constexpr auto accumulated_conversions_log2( ADC_Accumulation adc_accumulation ) noexcept
+    -> std::uint_fast8_t
+{
+    return to_underlying( adc_accumulation ) >> Peripheral::ADC::CTRLB::Bit::SAMPNUM;
+}
+
+/**
+ * \brief Get the number of conversions accumulated into a single result.
+ *
+ * \param[in] adc_accumulation The ADC accumulation.
+ *
+ * \return The number of conversions accumulated into a single result.
+ */
+constexpr auto accumulated_conversions( ADC_Accumulation adc_accumulation ) noexcept
+    -> std::uint_fast8_t
+{
+    return 1 << accumulated_conversions_log2( adc_accumulation );
+}
+
+/**
+ * \brief Get the effective resolution of an accumulated result.
+ *
+ * Each 4x increase in the number of accumulated conversions adds 1 bit of resolution
+ * (assuming the input noise is at least 1 LSB and uncorrelated with the conversions).
+ *
+ * \param[in] adc_resolution The ADC resolution.
+ * \param[in] adc_accumulation The ADC accumulation.
+ *
+ * \return The effective resolution (bits) of an accumulated result.
+ */
+constexpr auto effective_resolution( ADC_Resolution adc_resolution, ADC_Accumulation adc_accumulation ) noexcept
+    -> std::uint_fast8_t
+{
+    return bits( adc_resolution ) + accumulated_conversions_log2( adc_accumulation ) / 2;
+}
+
+/**
+ * \brief Scale an accumulated result to the effective resolution.
+ *
+ * \param[in] result The accumulated result (RES register value).
+ * \param[in] adc_accumulation The ADC accumulation that produced the result.
+ *
+ * \return The result, scaled to
+ *         picolibrary::Microchip::megaAVR0::ADC::effective_resolution() bits.
+ */
+constexpr auto scale( Sample result, ADC_Accumulation adc_accumulation ) noexcept -> Sample
+{
+    auto const n = accumulated_conversions_log2( adc_accumulation );
+
+    return result >> ( n - n / 2 );
+}
+
+/**
+ * \brief Get the mean of the conversions that were accumulated into a result.
+ *
+ * \param[in] result The accumulated result (RES register value).
+ * \param[in] adc_accumulation The ADC accumulation that produced the result.
+ *
+ * \return The mean of the conversions that were accumulated into the result.
+ */
+constexpr auto mean( Sample result, ADC_Accumulation adc_accumulation ) noexcept -> Sample
+{
+    return result >> accumulated_conversions_log2( adc_accumulation );
+}
+
+/**
+ * \brief Get the duration of a single conversion.
+ *
+ * A conversion is made up of a sampling phase (2 + SAMPLEN ADC clock cycles) followed by
+ * a successive approximation phase (1 ADC clock cycle plus 1 ADC clock cycle per bit).
+ * The sampling delay (CTRLD register SAMPDLY field) is assumed to be 0 (the drivers in
+ * this header clear the CTRLD register).
+ *
+ * \param[in] adc_resolution The ADC resolution.
+ * \param[in] adc_sample_length The ADC sample length (SAMPCTRL register SAMPLEN field
+ *            value).
+ *
+ * \return The duration (ADC clock cycles) of a single conversion.
+ */
+constexpr auto conversion_cycles( ADC_Resolution adc_resolution, std::uint8_t adc_sample_length ) noexcept
+    -> std::uint_fast8_t
+{
+    return 2 + adc_sample_length + 1 + bits( adc_resolution );
+}
+
+/**
+ * \brief Get the rate at which (free-running) results are produced.
+ *
+ * \param[in] clk_per_frequency The peripheral clock (CLK_PER) frequency (Hz).
+ * \param[in] adc_clock_prescaler The ADC clock prescaler.
+ * \param[in] adc_resolution The ADC resolution.
+ * \param[in] adc_accumulation The ADC accumulation.
+ * \param[in] adc_sample_length The ADC sample length (SAMPCTRL register SAMPLEN field
+ *            value).
+ *
+ * \return The rate (results per second) at which results are produced.
+ */
+constexpr auto result_rate(
+    std::uint32_t       clk_per_frequency,
+    ADC_Clock_Prescaler adc_clock_prescaler,
+    ADC_Resolution      adc_resolution,
+    ADC_Accumulation    adc_accumulation,
+    std::uint8_t        adc_sample_length ) noexcept -> std::uint32_t
+{
+    return clk_per_frequency / divisor( adc_clock_prescaler )
+           / ( std::uint32_t{ conversion_cycles( adc_resolution, adc_sample_length ) }
+               * accumulated_conversions( adc_accumulation ) );
+}
+
+static_assert( divisor( ADC_Clock_Prescaler::CLK_PER_2 ) == 2 );
+static_assert( divisor( ADC_Clock_Prescaler::CLK_PER_256 ) == 256 );
+static_assert( effective_resolution( ADC_Resolution::_10_BIT, ADC_Accumulation::NONE ) == 10 );
+static_assert( effective_resolution( ADC_Resolution::_10_BIT, ADC_Accumulation::_8 ) == 11 );
+static_assert( effective_resolution( ADC_Resolution::_10_BIT, ADC_Accumulation::_64 ) == 13 );
+static_assert( scale( 64 * 1023, ADC_Accumulation::_64 ) == 8184 );
+static_assert( scale( 8 * 1023, ADC_Accumulation::_8 ) == 2046 );
+static_assert( mean( 64 * 1023, ADC_Accumulation::_64 ) == 1023 );
+static_assert( conversion_cycles( ADC_Resolution::_10_BIT, 0 ) == 13 );
+static_assert(
+    result_rate( 16'000'000, ADC_Clock_Prescaler::CLK_PER_16, ADC_Resolution::_10_BIT, ADC_Accumulation::_64, 0 )
+    == 1201 );
+
+/**
+ * \brief Route an event generator to the ADC0 conversion start event input.
+ *
+ * \attention Some generators (e.g. the RTC PIT generators) are only available on, or
+ *            behave differently on, specific event system channels. See the event system
+ *            channel generator selection documentation for the device.
+ *
+ * \param[in] evsys_channel The event system channel used to route the event.
+ * \param[in] generator The event generator (e.g.
+ *            picolibrary::Microchip::megaAVR0::Peripheral::EVSYS::CHANNEL::GENERATOR_TCA0_OVF_LUNF).
+ */
+inline void route_conversion_trigger(
+    Peripheral::EVSYS::CHANNEL_Index       evsys_channel,
+    Peripheral::EVSYS::CHANNEL::GENERATOR generator ) noexcept
+{
+    auto & evsys = Peripheral::EVSYS0::instance();
+
+    evsys.channel[ evsys_channel ] = generator;
+    evsys.user[ Peripheral::EVSYS::USER_ADC0 ] = Peripheral::EVSYS::USER::CHANNEL_CHANNEL0
+                                                 + evsys_channel;
+}
+
+/**
+ * \brief Converter.
+ *
+ * The converter supports blocking single conversions, non-blocking (polled) single
+ * conversions, free-running conversion, and event triggered conversion.
+ */
+class Converter {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Converter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC peripheral to be used by the converter.
+     * \param[in] adc_reference The desired ADC reference.
+     * \param[in] adc_sampling_capacitance The desired ADC sampling capacitance.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler (the ADC clock
+     *            frequency must be between 50 kHz and 1.5 MHz for 10-bit resolution).
+     * \param[in] adc_resolution The desired ADC resolution.
+     */
+    Converter(
+        Peripheral::ADC &        adc,
+        ADC_Reference            adc_reference,
+        ADC_Sampling_Capacitance adc_sampling_capacitance,
+        ADC_Clock_Prescaler      adc_clock_prescaler,
+        ADC_Resolution           adc_resolution ) noexcept :
+        m_adc{ &adc }
+    {
+        configure_converter( adc_reference, adc_sampling_capacitance, adc_clock_prescaler, adc_resolution );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Converter( Converter && source ) noexcept :
+        m_adc{ source.m_adc }
+    {
+        source.m_adc = nullptr;
+    }
+
+    Converter( Converter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Converter() noexcept
+    {
+        disable();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Converter && expression ) noexcept -> Converter &
+    {
+        if ( &expression != this ) {
+            disable();
+
+            m_adc = expression.m_adc;
+
+            expression.m_adc = nullptr;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Converter const & ) = delete;
+
+    /**
+     * \brief Initialize the converter's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_adc->ctrla |= Peripheral::ADC::CTRLA::Mask::ENABLE;
+    }
+
+    /**
+     * \brief Select the input to convert.
+     *
+     * \param[in] adc_input The input to convert.
+     */
+    void select_input( ADC_Input adc_input ) noexcept
+    {
+        m_adc->muxpos = to_underlying( adc_input );
+    }
+
+    /**
+     * \brief Configure the number of conversions that are accumulated into a single
+     *        result.
+     *
+     * \attention Accumulated results are the sum of the accumulated conversions (see
+     *            picolibrary::Microchip::megaAVR0::ADC::scale() and
+     *            picolibrary::Microchip::megaAVR0::ADC::mean()).
+     *
+     * \param[in] adc_accumulation The desired ADC accumulation.
+     */
+    void configure_accumulation( ADC_Accumulation adc_accumulation ) noexcept
+    {
+        m_adc->ctrlb = to_underlying( adc_accumulation );
+    }
+
+    /**
+     * \brief Configure the sampling phase duration (2 + adc_sample_length ADC clock
+     *        cycles).
+     *
+     * \pre adc_sample_length <= picolibrary::Microchip::megaAVR0::ADC::ADC_SAMPLE_LENGTH_MAX
+     *
+     * \param[in] adc_sample_length The desired ADC sample length (SAMPCTRL register
+     *            SAMPLEN field value).
+     */
+    void configure_sample_length( std::uint8_t adc_sample_length ) noexcept
+    {
+        PICOLIBRARY_EXPECT( adc_sample_length <= ADC_SAMPLE_LENGTH_MAX, Generic_Error::INVALID_ARGUMENT );
+
+        m_adc->sampctrl = adc_sample_length;
+    }
+
+    /**
+     * \brief Perform a single conversion.
+     *
+     * \return The sample.
+     */
+    auto convert() noexcept -> Sample
+    {
+        initiate_conversion();
+
+        while ( not conversion_complete() ) {} // while
+
+        return sample();
+    }
+
+    /**
+     * \brief Initiate a single conversion.
+     */
+    void initiate_conversion() noexcept
+    {
+        m_adc->command = Peripheral::ADC::COMMAND::Mask::STCONV;
+    }
+
+    /**
+     * \brief Check if a conversion is complete.
+     *
+     * \return true if a conversion is complete.
+     * \return false if a conversion is not complete.
+     */
+    auto conversion_complete() const noexcept -> bool
+    {
+        return m_adc->intflags & Peripheral::ADC::INTFLAGS::Mask::RESRDY;
+    }
+
+    /**
+     * \brief Get the sample produced by the most recently completed conversion.
+     *
+     * \return The sample produced by the most recently completed conversion.
+     *
+     * \attention Getting the sample acknowledges the conversion's completion.
+     */
+    auto sample() noexcept -> Sample
+    {
+        return m_adc->res;
+    }
+
+    /**
+     * \brief Start free-running conversion (a new conversion is started as soon as the
+     *        previous conversion completes).
+     */
+    void start_free_running() noexcept
+    {
+        m_adc->ctrla |= Peripheral::ADC::CTRLA::Mask::FREERUN;
+
+        initiate_conversion();
+    }
+
+    /**
+     * \brief Stop free-running conversion.
+     *
+     * \attention The conversion that is in progress, if any, is completed.
+     */
+    void stop_free_running() noexcept
+    {
+        m_adc->ctrla &= static_cast<std::uint8_t>( ~Peripheral::ADC::CTRLA::Mask::FREERUN );
+    }
+
+    /**
+     * \brief Start event triggered conversion (a conversion is started by each event
+     *        received on the ADC peripheral's start event input, see
+     *        picolibrary::Microchip::megaAVR0::ADC::route_conversion_trigger()).
+     *
+     * \attention Events received while a conversion is in progress are ignored.
+     */
+    void start_event_triggered() noexcept
+    {
+        m_adc->evctrl = Peripheral::ADC::EVCTRL::Mask::STARTEI;
+    }
+
+    /**
+     * \brief Stop event triggered conversion.
+     *
+     * \attention The conversion that is in progress, if any, is completed.
+     */
+    void stop_event_triggered() noexcept
+    {
+        m_adc->evctrl = 0;
+    }
+
+  protected:
+    /**
+     * \brief Get the ADC peripheral used by the converter.
+     *
+     * \return The ADC peripheral used by the converter.
+     */
+    auto adc() noexcept -> Peripheral::ADC &
+    {
+        return *m_adc;
+    }
+
+  private:
+    /**
+     * \brief The ADC peripheral used by the converter.
+     */
+    Peripheral::ADC * m_adc{};
+
+    /**
+     * \brief Disable the converter.
+     */
+    constexpr void disable() noexcept
+    {
+        if ( m_adc ) {
+            m_adc->intctrl = 0;
+            m_adc->ctrla   = 0;
+        } // if
+    }
+
+    /**
+     * \brief Configure the converter.
+     *
+     * \param[in] adc_reference The desired ADC reference.
+     * \param[in] adc_sampling_capacitance The desired ADC sampling capacitance.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler.
+     * \param[in] adc_resolution The desired ADC resolution.
+     */
+    void configure_converter(
+        ADC_Reference            adc_reference,
+        ADC_Sampling_Capacitance adc_sampling_capacitance,
+        ADC_Clock_Prescaler      adc_clock_prescaler,
+        ADC_Resolution           adc_resolution ) noexcept
+    {
+        m_adc->ctrla = to_underlying( adc_resolution );
+        m_adc->ctrlb = Peripheral::ADC::CTRLB::SAMPNUM_NONE;
+        m_adc->ctrlc = to_underlying( adc_reference ) | to_underlying( adc_sampling_capacitance )
+                       | to_underlying( adc_clock_prescaler );
+        m_adc->ctrld = Peripheral::ADC::CTRLD::INITDLY_DLY0 | Peripheral::ADC::CTRLD::ASDV_ASVOFF;
+
+        m_adc->ctrle    = Peripheral::ADC::CTRLE::WINCM_NONE;
+        m_adc->sampctrl = 0;
+        m_adc->evctrl   = 0;
+
+        m_adc->intctrl  = 0;
+        m_adc->intflags = Peripheral::ADC::INTFLAGS::Mask::RESRDY
+                          | Peripheral::ADC::INTFLAGS::Mask::WCMP;
+    }
+};
+
+/**
+ * \brief Buffered converter.
+ *
+ * The buffered converter's result ready interrupt handler writes each sample to a
+ * picolibrary::Microchip::megaAVR0::Ring_Buffer, so conversions (single or free-running)
+ * continue while the main loop is busy. The main loop reads the samples at its own pace.
+ * picolibrary::Microchip::megaAVR0::ADC::Buffered_Converter::handle_result_ready() must
+ * be bound to the ADC peripheral's RESRDY interrupt (see
+ * picolibrary::Microchip::megaAVR0::Interrupt::Binding).
+ *
+ * \tparam CAPACITY The sample buffer capacity (must be a power of two between 2 and
+ *         128).
+ */
+template<std::uint_fast8_t CAPACITY>
+class Buffered_Converter : private Converter {
+  public:
+    /**
+     * \brief The sample buffer.
+     */
+    using Sample_Buffer = Ring_Buffer<Sample, CAPACITY>;
+
+    /**
+     * \brief The unsigned integral type used to represent the number of samples that
+     *        were discarded because the sample buffer was full.
+     */
+    using Overruns = std::uint16_t;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC peripheral to be used by the buffered converter.
+     * \param[in] adc_reference The desired ADC reference.
+     * \param[in] adc_sampling_capacitance The desired ADC sampling capacitance.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler (the ADC clock
+     *            frequency must be between 50 kHz and 1.5 MHz for 10-bit resolution).
+     * \param[in] adc_resolution The desired ADC resolution.
+     */
+    Buffered_Converter(
+        Peripheral::ADC &        adc,
+        ADC_Reference            adc_reference,
+        ADC_Sampling_Capacitance adc_sampling_capacitance,
+        ADC_Clock_Prescaler      adc_clock_prescaler,
+        ADC_Resolution           adc_resolution ) noexcept :
+        Converter{ adc, adc_reference, adc_sampling_capacitance, adc_clock_prescaler, adc_resolution }
+    {
+    }
+
+    Buffered_Converter( Buffered_Converter && ) = delete;
+
+    Buffered_Converter( Buffered_Converter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Buffered_Converter() noexcept = default;
+
+    auto operator=( Buffered_Converter && ) = delete;
+
+    auto operator=( Buffered_Converter const & ) = delete;
+
+    /**
+     * \brief Initialize the buffered converter's hardware (enables the ADC peripheral and
+     *        its RESRDY interrupt).
+     */
+    void initialize() noexcept
+    {
+        Converter::initialize();
+
+        adc().intctrl = Peripheral::ADC::INTCTRL::Mask::RESRDY;
+    }
+
+    using Converter::configure_accumulation;
+    using Converter::configure_sample_length;
+    using Converter::initiate_conversion;
+    using Converter::select_input;
+    using Converter::start_event_triggered;
+    using Converter::start_free_running;
+    using Converter::stop_event_triggered;
+    using Converter::stop_free_running;
+
+    /**
+     * \brief Check if a sample is available.
+     *
+     * \return true if a sample is available.
+     * \return false if a sample is not available.
+     */
+    auto sample_available() const noexcept -> bool
+    {
+        return not m_samples.empty();
+    }
+
+    /**
+     * \brief Get the oldest available sample.
+     *
+     * \pre picolibrary::Microchip::megaAVR0::ADC::Buffered_Converter::sample_available()
+     *
+     * \return The oldest available sample.
+     */
+    auto sample() noexcept -> Sample
+    {
+        auto const sample = m_samples.front();
+
+        m_samples.pop();
+
+        return sample;
+    }
+
+    /**
+     * \brief Get the sample buffer (for bulk reads using the sample buffer's consumer
+     *        member functions).
+     *
+     * \return The sample buffer.
+     */
+    auto samples() noexcept -> Sample_Buffer &
+    {
+        return m_samples;
+    }
+
+    /**
+     * \brief Get the number of samples that were discarded because the sample buffer was
+     *        full.
+     *
+     * \return The number of samples that were discarded because the sample buffer was
+     *         full (saturates at the maximum value representable by
+     *         picolibrary::Microchip::megaAVR0::ADC::Buffered_Converter::Overruns).
+     */
+    auto overruns() const noexcept -> Overruns
+    {
+        Interrupt::Critical_Section const critical_section;
+
+        return m_overruns;
+    }
+
+    /**
+     * \brief Handle a RESRDY interrupt.
+     *
+     * \attention This function must only be called from the ADC peripheral's RESRDY
+     *            interrupt handler.
+     */
+    void handle_result_ready() noexcept
+    {
+        // reading the result acknowledges the interrupt
+        auto const sample = Converter::sample();
+
+        if ( m_samples.full() ) {
+            Overruns const overruns = m_overruns;
+
+            if ( overruns != std::numeric_limits<Overruns>::max() ) {
+                m_overruns = overruns + 1;
+            } // if
+
+            return;
+        } // if
+
+        m_samples.push( sample );
+    }
+
+  private:
+    /**
+     * \brief The sample buffer.
+     */
+    Sample_Buffer m_samples{};
+
+    /**
+     * \brief The number of samples that were discarded because the sample buffer was
+     *        full.
+     */
+    Overruns volatile m_overruns{};
+};
+
+/**
+ * \brief Window monitor.
+ *
+ * The window monitor uses the ADC peripheral's window comparator to interrupt the CPU
+ * only when a result satisfies the window condition, so the CPU can sleep while the
+ * monitored input stays where it is expected to be. The window comparator interrupt is
+ * one-shot: it is disabled when the window condition is detected, and must be rearmed
+ * once the detection has been handled.
+ * picolibrary::Microchip::megaAVR0::ADC::Window_Monitor::handle_window_comparison() must
+ * be bound to the ADC peripheral's WCOMP interrupt (see
+ * picolibrary::Microchip::megaAVR0::Interrupt::Binding).
+ */
+class Window_Monitor : private Converter {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC peripheral to be used by the window monitor.
+     * \param[in] adc_reference The desired ADC reference.
+     * \param[in] adc_sampling_capacitance The desired ADC sampling capacitance.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler (the ADC clock
+     *            frequency must be between 50 kHz and 1.5 MHz for 10-bit resolution).
+     * \param[in] adc_resolution The desired ADC resolution.
+     */
+    Window_Monitor(
+        Peripheral::ADC &        adc,
+        ADC_Reference            adc_reference,
+        ADC_Sampling_Capacitance adc_sampling_capacitance,
+        ADC_Clock_Prescaler      adc_clock_prescaler,
+        ADC_Resolution           adc_resolution ) noexcept :
+        Converter{ adc, adc_reference, adc_sampling_capacitance, adc_clock_prescaler, adc_resolution }
+    {
+    }
+
+    Window_Monitor( Window_Monitor && ) = delete;
+
+    Window_Monitor( Window_Monitor const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Window_Monitor() noexcept = default;
+
+    auto operator=( Window_Monitor && ) = delete;
+
+    auto operator=( Window_Monitor const & ) = delete;
+
+    using Converter::configure_accumulation;
+    using Converter::configure_sample_length;
+    using Converter::initialize;
+    using Converter::initiate_conversion;
+    using Converter::select_input;
+    using Converter::start_event_triggered;
+    using Converter::start_free_running;
+    using Converter::stop_event_triggered;
+    using Converter::stop_free_running;
+
+    /**
+     * \brief Configure the window.
+     *
+     * \attention The thresholds are compared against the raw result. If conversions are
+     *            being accumulated, the thresholds must be expressed as sums of the
+     *            accumulated conversions.
+     *
+     * \param[in] adc_window_mode The desired ADC window comparison mode.
+     * \param[in] low_threshold The desired low threshold (not used by
+     *            picolibrary::Microchip::megaAVR0::ADC::ADC_Window_Mode::ABOVE).
+     * \param[in] high_threshold The desired high threshold (not used by
+     *            picolibrary::Microchip::megaAVR0::ADC::ADC_Window_Mode::BELOW).
+     */
+    void configure_window( ADC_Window_Mode adc_window_mode, Sample low_threshold, Sample high_threshold ) noexcept
+    {
+        adc().winlt = low_threshold;
+        adc().winht = high_threshold;
+        adc().ctrle = to_underlying( adc_window_mode );
+    }
+
+    /**
+     * \brief Arm the window comparator interrupt (clears any previous detection).
+     */
+    void arm() noexcept
+    {
+        m_condition_detected = false;
+
+        adc().intflags = Peripheral::ADC::INTFLAGS::Mask::WCMP;
+        adc().intctrl  = Peripheral::ADC::INTCTRL::Mask::WCMP;
+    }
+
+    /**
+     * \brief Disarm the window comparator interrupt.
+     */
+    void disarm() noexcept
+    {
+        adc().intctrl = 0;
+    }
+
+    /**
+     * \brief Check if the window condition has been detected since the window comparator
+     *        interrupt was last armed.
+     *
+     * \return true if the window condition has been detected.
+     * \return false if the window condition has not been detected.
+     */
+    auto condition_detected() const noexcept -> bool
+    {
+        return m_condition_detected;
+    }
+
+    /**
+     * \brief Get the result that satisfied the window condition.
+     *
+     * \pre picolibrary::Microchip::megaAVR0::ADC::Window_Monitor::condition_detected()
+     *
+     * \return The result that satisfied the window condition.
+     */
+    auto sample() const noexcept -> Sample
+    {
+        return m_sample;
+    }
+
+    /**
+     * \brief Handle a WCOMP interrupt.
+     *
+     * \attention This function must only be called from the ADC peripheral's WCOMP
+     *            interrupt handler.
+     */
+    void handle_window_comparison() noexcept
+    {
+        m_sample = Converter::sample();
+
+        adc().intctrl  = 0;
+        adc().intflags = Peripheral::ADC::INTFLAGS::Mask::WCMP;
+
+        m_condition_detected = true;
+    }
+
+  private:
+    /**
+     * \brief The result that satisfied the window condition.
+     */
+    Sample volatile m_sample{};
+
+    /**
+     * \brief The window condition detected flag.
+     */
+    bool volatile m_condition_detected{};
+};
+
+/**
+ * \brief Block sampler.
+ *
+ * The block sampler captures event triggered conversions into a pair of sample blocks.
+ * Conversions are started by a hardware event (e.g. a TCA overflow or an RTC periodic
+ * interrupt timer event, see
+ * picolibrary::Microchip::megaAVR0::ADC::route_conversion_trigger()), so the sampling
+ * instants do not depend on interrupt latency. The result ready interrupt handler only
+ * stores each result. While the main loop processes one block, the interrupt handler
+ * fills the other. If both blocks are full, results are discarded and the overrun flag
+ * is set. picolibrary::Microchip::megaAVR0::ADC::Block_Sampler::handle_result_ready()
+ * must be bound to the ADC peripheral's RESRDY interrupt (see
+ * picolibrary::Microchip::megaAVR0::Interrupt::Binding).
+ *
+ * \tparam BLOCK_SIZE The number of samples in a block.
+ */
+template<std::uint_fast8_t BLOCK_SIZE>
+class Block_Sampler : private Converter {
+  public:
+    static_assert( BLOCK_SIZE > 0, "BLOCK_SIZE must be greater than 0" );
+
+    /**
+     * \brief Sample block.
+     */
+    using Block = Sample[ BLOCK_SIZE ];
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC peripheral to be used by the block sampler.
+     * \param[in] adc_reference The desired ADC reference.
+     * \param[in] adc_sampling_capacitance The desired ADC sampling capacitance.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler (the ADC clock
+     *            frequency must be between 50 kHz and 1.5 MHz for 10-bit resolution).
+     * \param[in] adc_resolution The desired ADC resolution.
+     */
+    Block_Sampler(
+        Peripheral::ADC &        adc,
+        ADC_Reference            adc_reference,
+        ADC_Sampling_Capacitance adc_sampling_capacitance,
+        ADC_Clock_Prescaler      adc_clock_prescaler,
+        ADC_Resolution           adc_resolution ) noexcept :
+        Converter{ adc, adc_reference, adc_sampling_capacitance, adc_clock_prescaler, adc_resolution }
+    {
+    }
+
+    Block_Sampler( Block_Sampler && ) = delete;
+
+    Block_Sampler( Block_Sampler const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Block_Sampler() noexcept = default;
+
+    auto operator=( Block_Sampler && ) = delete;
+
+    auto operator=( Block_Sampler const & ) = delete;
+
+    /**
+     * \brief Initialize the block sampler's hardware (enables the ADC peripheral and its
+     *        RESRDY interrupt).
+     */
+    void initialize() noexcept
+    {
+        Converter::initialize();
+
+        adc().intctrl = Peripheral::ADC::INTCTRL::Mask::RESRDY;
+    }
+
+    using Converter::configure_accumulation;
+    using Converter::configure_sample_length;
+    using Converter::select_input;
+    using Converter::start_event_triggered;
+    using Converter::stop_event_triggered;
+
+    /**
+     * \brief Check if a full block is available.
+     *
+     * \return true if a full block is available.
+     * \return false if a full block is not available.
+     */
+    auto block_available() const noexcept -> bool
+    {
+        bool const block_available = m_block_available;
+
+        asm volatile( "" ::: "memory" );
+
+        return block_available;
+    }
+
+    /**
+     * \brief Get the available block.
+     *
+     * \pre picolibrary::Microchip::megaAVR0::ADC::Block_Sampler::block_available()
+     *
+     * \return The available block.
+     *
+     * \attention The block remains valid until it is released (see
+     *            picolibrary::Microchip::megaAVR0::ADC::Block_Sampler::release_block()).
+     */
+    auto block() const noexcept -> Block const &
+    {
+        return m_blocks[ m_fill_block ^ 1 ];
+    }
+
+    /**
+     * \brief Release the available block so that it can be refilled.
+     *
+     * \pre picolibrary::Microchip::megaAVR0::ADC::Block_Sampler::block_available()
+     */
+    void release_block() noexcept
+    {
+        Interrupt::Critical_Section const critical_section;
+
+        m_block_available = false;
+
+        if ( m_fill_count == BLOCK_SIZE ) {
+            swap_blocks();
+        } // if
+    }
+
+    /**
+     * \brief Check if results have been discarded because both blocks were full.
+     *
+     * \return true if results have been discarded since the overrun flag was last
+     *         cleared.
+     * \return false if results have not been discarded since the overrun flag was last
+     *         cleared.
+     */
+    auto overrun() const noexcept -> bool
+    {
+        return m_overrun;
+    }
+
+    /**
+     * \brief Clear the overrun flag.
+     */
+    void clear_overrun() noexcept
+    {
+        m_overrun = false;
+    }
+
+    /**
+     * \brief Handle a RESRDY interrupt.
+     *
+     * \attention This function must only be called from the ADC peripheral's RESRDY
+     *            interrupt handler.
+     */
+    void handle_result_ready() noexcept
+    {
+        // reading the result acknowledges the interrupt
+        auto const sample = Converter::sample();
+
+        std::uint_fast8_t const fill_count = m_fill_count;
+
+        if ( fill_count == BLOCK_SIZE ) {
+            m_overrun = true;
+
+            return;
+        } // if
+
+        m_blocks[ m_fill_block ][ fill_count ] = sample;
+
+        m_fill_count = fill_count + 1;
+
+        if ( fill_count + 1 == BLOCK_SIZE and not m_block_available ) {
+            swap_blocks();
+        } // if
+    }
+
+  private:
+    /**
+     * \brief The sample blocks.
+     */
+    Block m_blocks[ 2 ]{};
+
+    /**
+     * \brief The index of the block that is being filled.
+     */
+    std::uint8_t volatile m_fill_block{};
+
+    /**
+     * \brief The number of samples in the block that is being filled.
+     */
+    std::uint8_t volatile m_fill_count{};
+
+    /**
+     * \brief The block available flag.
+     */
+    bool volatile m_block_available{};
+
+    /**
+     * \brief The overrun flag.
+     */
+    bool volatile m_overrun{};
+
+    /**
+     * \brief Make the full block that is being filled available and start filling the
+     *        other block.
+     *
+     * \attention Must be called with interrupts disabled or from the RESRDY interrupt
+     *            handler.
+     */
+    void swap_blocks() noexcept
+    {
+        asm volatile( "" ::: "memory" );
+
+        m_fill_block      = m_fill_block ^ 1;
+        m_fill_count      = 0;
+        m_block_available = true;
+    }
+};
+
+/**
+ * \brief Scan sequencer channel.
+ *
+ * \tparam INPUT The channel's input.
+ * \tparam SAMPLE_LENGTH The channel's ADC sample length (SAMPCTRL register SAMPLEN field
+ *         value).
+ * \tparam REFERENCE The channel's ADC reference (optional, defaults to the scan
+ *         sequencer's ADC reference).
+ */
+template<ADC_Input INPUT, std::uint8_t SAMPLE_LENGTH = 0, ADC_Reference... REFERENCE>
+struct Scan_Channel {
+    static_assert( SAMPLE_LENGTH <= ADC_SAMPLE_LENGTH_MAX, "invalid ADC sample length" );
+    static_assert( sizeof...( REFERENCE ) <= 1, "at most one ADC reference may be specified" );
+
+    /**
+     * \brief The channel's input.
+     */
+    static constexpr auto INPUT_VALUE = INPUT;
+
+    /**
+     * \brief The channel's ADC sample length.
+     */
+    static constexpr auto SAMPLE_LENGTH_VALUE = SAMPLE_LENGTH;
+
+    /**
+     * \brief The channel has its own ADC reference.
+     */
+    static constexpr auto REFERENCE_SPECIFIED = sizeof...( REFERENCE ) > 0;
+
+    /**
+     * \brief Get the channel's ADC reference.
+     *
+     * \param[in] adc_reference The scan sequencer's ADC reference.
+     *
+     * \return The channel's ADC reference.
+     */
+    static constexpr auto reference( ADC_Reference adc_reference ) noexcept -> ADC_Reference
+    {
+        if constexpr ( REFERENCE_SPECIFIED ) {
+            return ( REFERENCE, ... );
+        } else {
+            return adc_reference;
+        } // else
+    }
+};
+
+/**
+ * \brief Scan sequencer.
+ *
+ * The scan sequencer's result ready interrupt handler stores each result, selects the
+ * next channel (input, and, if specified by any channel, sample length and reference),
+ * and starts the next conversion, so all channels are converted in a round robin without
+ * involving the main loop. Complete frames (one sample per channel) are double buffered:
+ * the interrupt handler fills one frame while the other holds the most recently published
+ * frame. The main loop copies the published frame without disabling interrupts, retrying
+ * if a new frame was published during the copy, so a copied frame never mixes samples
+ * from different scans.
+ * picolibrary::Microchip::megaAVR0::ADC::Scan_Sequencer::handle_result_ready() must be
+ * bound to the ADC peripheral's RESRDY interrupt (see
+ * picolibrary::Microchip::megaAVR0::Interrupt::Binding).
+ *
+ * Channels are identified by their index in the Channels template parameter pack.
+ *
+ * If any channel specifies its own reference, the ADC initialization delay (CTRLD
+ * register INITDLY field) is set to 64 ADC clock cycles so that an internal reference has
+ * started up before it is sampled, and the first conversion following each reference
+ * change is discarded (the channel is converted again) so that a channel's sample never
+ * reflects a reference that is still settling. Channels that use the same reference
+ * should be adjacent in the channel list to minimize the number of discarded
+ * conversions.
+ *
+ * \tparam Channels The channels to scan (picolibrary::Microchip::megaAVR0::ADC::Scan_Channel).
+ */
+template<typename... Channels>
+class Scan_Sequencer : private Converter {
+  public:
+    static_assert( sizeof...( Channels ) > 0 );
+
+    /**
+     * \brief The number of channels that are scanned.
+     */
+    static constexpr auto CHANNELS = std::uint_fast8_t{ sizeof...( Channels ) };
+
+    /**
+     * \brief Frame (one sample per channel, indexed by channel).
+     */
+    using Frame = Sample[ CHANNELS ];
+
+    /**
+     * \brief Frame number (incremented, with wrap around, each time a frame is
+     *        published).
+     */
+    using Frame_Number = std::uint8_t;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC peripheral to be used by the scan sequencer.
+     * \param[in] adc_reference The desired ADC reference (used by channels that do not
+     *            specify a reference).
+     * \param[in] adc_sampling_capacitance The desired ADC sampling capacitance.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler (the ADC clock
+     *            frequency must be between 50 kHz and 1.5 MHz for 10-bit resolution).
+     * \param[in] adc_resolution The desired ADC resolution.
+     */
+    Scan_Sequencer(
+        Peripheral::ADC &        adc,
+        ADC_Reference            adc_reference,
+        ADC_Sampling_Capacitance adc_sampling_capacitance,
+        ADC_Clock_Prescaler      adc_clock_prescaler,
+        ADC_Resolution           adc_resolution ) noexcept :
+        Converter{ adc, adc_reference, adc_sampling_capacitance, adc_clock_prescaler, adc_resolution },
+        m_ctrlc{ static_cast<std::uint8_t>(
+            to_underlying( Channels::reference( adc_reference ) )
+            | to_underlying( adc_sampling_capacitance ) | to_underlying( adc_clock_prescaler ) )... }
+    {
+    }
+
+    Scan_Sequencer( Scan_Sequencer && ) = delete;
+
+    Scan_Sequencer( Scan_Sequencer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Scan_Sequencer() noexcept = default;
+
+    auto operator=( Scan_Sequencer && ) = delete;
+
+    auto operator=( Scan_Sequencer const & ) = delete;
+
+    /**
+     * \brief Initialize the scan sequencer's hardware (enables the ADC peripheral and its
+     *        RESRDY interrupt).
+     */
+    void initialize() noexcept
+    {
+        if constexpr ( REFERENCE_SPECIFIED ) {
+            adc().ctrld = Peripheral::ADC::CTRLD::INITDLY_DLY64;
+        } // if
+
+        Converter::initialize();
+
+        adc().intctrl = Peripheral::ADC::INTCTRL::Mask::RESRDY;
+    }
+
+    using Converter::configure_accumulation;
+
+    /**
+     * \brief Start scanning (the first scan starts with the first channel).
+     *
+     * \pre scanning has not been started, or has been stopped using
+     *      picolibrary::Microchip::megaAVR0::ADC::Scan_Sequencer::stop_scanning()
+     */
+    void start_scanning() noexcept
+    {
+        m_channel  = 0;
+        m_settling = false;
+        m_scanning = true;
+
+        select_channel( 0 );
+        initiate_conversion();
+    }
+
+    /**
+     * \brief Stop scanning.
+     *
+     * The conversion that is in progress, if any, is completed and its result is stored,
+     * but the frame that is being filled is not published.
+     *
+     * \attention Interrupts must be enabled since this function waits for the RESRDY
+     *            interrupt handler to handle the conversion that is in progress.
+     */
+    void stop_scanning() noexcept
+    {
+        m_scanning = false;
+
+        while ( adc().command & Peripheral::ADC::COMMAND::Mask::STCONV
+                or adc().intflags & Peripheral::ADC::INTFLAGS::Mask::RESRDY ) {
+        } // while
+    }
+
+    /**
+     * \brief Get the number of the most recently published frame.
+     *
+     * \return The number of the most recently published frame (0 if no frame has been
+     *         published yet).
+     */
+    auto frame_number() const noexcept -> Frame_Number
+    {
+        return m_frame_number;
+    }
+
+    /**
+     * \brief Copy the most recently published frame.
+     *
+     * \param[out] frame The frame to copy the most recently published frame to.
+     *
+     * \return The number of the copied frame.
+     */
+    auto read_frame( Frame & frame ) const noexcept -> Frame_Number
+    {
+        for ( ;; ) {
+            Frame_Number const frame_number = m_frame_number;
+
+            asm volatile( "" ::: "memory" );
+
+            auto const & published_frame = m_frames[ frame_number & 0x1 ];
+
+            for ( auto channel = std::uint_fast8_t{}; channel < CHANNELS; ++channel ) {
+                frame[ channel ] = published_frame[ channel ];
+            } // for
+
+            asm volatile( "" ::: "memory" );
+
+            if ( m_frame_number == frame_number ) {
+                return frame_number;
+            } // if
+        }     // for
+    }
+
+    /**
+     * \brief Handle a RESRDY interrupt.
+     *
+     * \attention This function must only be called from the ADC peripheral's RESRDY
+     *            interrupt handler.
+     */
+    void handle_result_ready() noexcept
+    {
+        // reading the result acknowledges the interrupt
+        auto const sample = Converter::sample();
+
+        if constexpr ( REFERENCE_SPECIFIED ) {
+            if ( m_settling ) {
+                m_settling = false;
+
+                if ( m_scanning ) {
+                    initiate_conversion();
+                } // if
+
+                return;
+            } // if
+        } // if
+
+        Frame_Number const frame_number = m_frame_number;
+        std::uint_fast8_t  channel      = m_channel;
+
+        m_frames[ ( frame_number + 1 ) & 0x1 ][ channel ] = sample;
+
+        if ( ++channel == CHANNELS ) {
+            channel = 0;
+
+            asm volatile( "" ::: "memory" );
+
+            m_frame_number = frame_number + 1;
+        } // if
+
+        m_channel = channel;
+
+        if ( m_scanning ) {
+            select_channel( channel );
+            initiate_conversion();
+        } // if
+    }
+
+  private:
+    /**
+     * \brief The channel inputs (MUXPOS register values).
+     */
+    static constexpr std::uint8_t INPUTS[] = { to_underlying( Channels::INPUT_VALUE )... };
+
+    /**
+     * \brief The channel sample lengths (SAMPCTRL register values).
+     */
+    static constexpr std::uint8_t SAMPLE_LENGTHS[] = { Channels::SAMPLE_LENGTH_VALUE... };
+
+    /**
+     * \brief At least one channel has a non-default sample length.
+     */
+    static constexpr auto SAMPLE_LENGTH_SPECIFIED = ( ( Channels::SAMPLE_LENGTH_VALUE != 0 ) or ... );
+
+    /**
+     * \brief At least one channel has its own reference.
+     */
+    static constexpr auto REFERENCE_SPECIFIED = ( Channels::REFERENCE_SPECIFIED or ... );
+
+    /**
+     * \brief The channel CTRLC register values.
+     */
+    std::uint8_t const m_ctrlc[ CHANNELS ];
+
+    /**
+     * \brief The frames.
+     */
+    Frame m_frames[ 2 ]{};
+
+    /**
+     * \brief The number of the most recently published frame.
+     */
+    Frame_Number volatile m_frame_number{};
+
+    /**
+     * \brief The channel that is being converted.
+     */
+    std::uint8_t volatile m_channel{};
+
+    /**
+     * \brief The scanning flag.
+     */
+    bool volatile m_scanning{};
+
+    /**
+     * \brief The reference settling flag (the conversion that is in progress is the
+     *        first conversion following a reference change, and will be discarded).
+     */
+    bool volatile m_settling{};
+
+    /**
+     * \brief Select a channel.
+     *
+     * \param[in] channel The channel to select.
+     */
+    void select_channel( std::uint_fast8_t channel ) noexcept
+    {
+        adc().muxpos = INPUTS[ channel ];
+
+        if constexpr ( SAMPLE_LENGTH_SPECIFIED ) {
+            adc().sampctrl = SAMPLE_LENGTHS[ channel ];
+        } // if
+
+        if constexpr ( REFERENCE_SPECIFIED ) {
+            std::uint8_t const ctrlc = m_ctrlc[ channel ];
+
+            if ( adc().ctrlc != ctrlc ) {
+                adc().ctrlc = ctrlc;
+
+                m_settling = true;
+            } // if
+        } // if
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::ADC
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_ADC_H
@@ -78,8 +78,13 @@ enum class USART_Clock_Generator_Operating_Speed : std::uint8_t {
  *
  * \tparam Data_Type The integral type used to hold the data to be transmitted (must be
  *         std::uint8_t or std::uint16_t).
+ * \tparam USART_Signals_Type The USART peripheral and routing configuration used by the
+ *         transmitter
+ *         (picolibrary::Microchip::megaAVR0::Multiplexed_Signals::USART_Signals) if they
+ *         are known at compile-time, or void if the USART peripheral is supplied to the
+ *         constructor.
  */
-template<typename Data_Type>
+template<typename Data_Type, typename USART_Signals_Type = void>
 class Basic_Transmitter {
   public:
     static_assert( std::is_same_v<Data_Type, std::uint8_t> or std::is_same_v<Data_Type, std::uint16_t> );
@@ -120,6 +125,8 @@ class Basic_Transmitter {
     {
         // #lizard forgives the parameter count
 
+        static_assert( std::is_void_v<USART_Signals_Type> );
+
         configure_transmitter(
             usart_data_bits, usart_parity, usart_stop_bits, usart_clock_generator_operating_speed, usart_clock_generator_scaling_factor );
     }
@@ -149,12 +156,44 @@ class Basic_Transmitter {
     {
         // #lizard forgives the parameter count
 
+        static_assert( std::is_void_v<USART_Signals_Type> );
+
         Multiplexed_Signals::set_usart_route( usart, usart_route );
 
         configure_transmitter(
             usart_data_bits, usart_parity, usart_stop_bits, usart_clock_generator_operating_speed, usart_clock_generator_scaling_factor );
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \attention This constructor can only be used if the transmitter's USART peripheral
+     *            and routing configuration are known at compile-time.
+     *
+     * \param[in] usart_data_bits The desired USART data bits configuration.
+     * \param[in] usart_parity The desired USART parity configuration.
+     * \param[in] usart_stop_bits The desired USART stop bits configuration.
+     * \param[in] usart_clock_generator_operating_speed The desired USART clock generator
+     *            operating speed configuration.
+     * \param[in] usart_clock_generator_scaling_factor The desired USART clock generator
+     *            scaling factor (BAUD register value).
+     */
+    Basic_Transmitter(
+        USART_Data_Bits                       usart_data_bits,
+        USART_Parity                          usart_parity,
+        USART_Stop_Bits                       usart_stop_bits,
+        USART_Clock_Generator_Operating_Speed usart_clock_generator_operating_speed,
+        std::uint16_t usart_clock_generator_scaling_factor ) noexcept :
+        m_usart{ &USART_Signals_Type::Instance::instance() }
+    {
+        // #lizard forgives the parameter count
+
+        USART_Signals_Type::set_route();
+
+        configure_transmitter(
+            usart_data_bits, usart_parity, usart_stop_bits, usart_clock_generator_operating_speed, usart_clock_generator_scaling_factor );
+    }
+
     /**
      * \brief Constructor.
      *
@@ -277,11 +316,18 @@ class Basic_Transmitter {
      */
     void configure_txd_pin_as_output() noexcept
     {
-        auto &     txd_port = Multiplexed_Signals::txd_port( *m_usart );
-        auto const txd_mask = Multiplexed_Signals::txd_mask( *m_usart );
-
-        txd_port.outset = txd_mask;
-        txd_port.dirset = txd_mask;
+        if constexpr ( std::is_void_v<USART_Signals_Type> ) {
+            auto &     txd_port = Multiplexed_Signals::txd_port( *m_usart );
+            auto const txd_mask = Multiplexed_Signals::txd_mask( *m_usart );
+
+            txd_port.outset = txd_mask;
+            txd_port.dirset = txd_mask;
+        } else {
+            auto & txd_port = USART_Signals_Type::PORT_Instance::instance();
+
+            txd_port.outset = USART_Signals_Type::TXD_MASK;
+            txd_port.dirset = USART_Signals_Type::TXD_MASK;
+        } // else
     }
 
     /**
@@ -330,9 +376,14 @@ class Basic_Transmitter {
  *
  * \tparam Data_Type The integral type used to hold the data to be transmitted (must be
  *         std::uint8_t or std::uint16_t).
+ * \tparam USART_Signals_Type The USART peripheral and routing configuration used by the
+ *         transmitter
+ *         (picolibrary::Microchip::megaAVR0::Multiplexed_Signals::USART_Signals) if they
+ *         are known at compile-time, or void if the USART peripheral is supplied to the
+ *         constructor.
  */
-template<typename Data_Type>
-using Transmitter = ::picolibrary::Asynchronous_Serial::Transmitter<Basic_Transmitter<Data_Type>>;
+template<typename Data_Type, typename USART_Signals_Type = void>
+using Transmitter = ::picolibrary::Asynchronous_Serial::Transmitter<Basic_Transmitter<Data_Type, USART_Signals_Type>>;
 
 } // namespace picolibrary::Microchip::megaAVR0::Asynchronous_Serial
 
@@ -0,0 +1,349 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Calibrator
+ *        interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_CALIBRATION_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_CALIBRATION_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr0/clock.h"
+#include "picolibrary/microchip/megaavr0/clock_plan.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/peripheral/clkctrl.h"
+#include "picolibrary/microchip/megaavr0/peripheral/evsys.h"
+#include "picolibrary/microchip/megaavr0/peripheral/rtc.h"
+#include "picolibrary/microchip/megaavr0/peripheral/tcb.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::megaAVR0::Clock {
+
+/**
+ * \brief Internal 16/20 MHz oscillator calibrator.
+ *
+ * \tparam Clock_Plan The clock plan (picolibrary::Microchip::megaAVR0::Clock::Plan) the
+ *         clock is configured with. The plan's clock source must be the internal 16/20
+ *         MHz oscillator.
+ * \tparam TCB_Instance The TCB peripheral instance used to measure the peripheral clock
+ *         (e.g. picolibrary::Microchip::megaAVR0::Peripheral::TCB0).
+ * \tparam EVSYS_CHANNEL The event system channel used to route the reference clock to
+ *         the TCB. Must be an odd channel.
+ *
+ * The calibrator measures the peripheral clock (CLK_PER) against a reference clock
+ * derived from the external 32.768 kHz crystal oscillator. The RTC periodic interrupt
+ * timer (PIT) divides the crystal by 64, and the resulting 512 Hz event is routed to a
+ * TCB in input capture frequency measurement mode (CNTMODE_FRQ). The calibrator then
+ * adjusts the internal 16/20 MHz oscillator's calibration value (CLKCTRL.OSC20MCALIBA
+ * register CAL20M field) until the measured period matches the period expected by the
+ * clock plan.
+ *
+ * \attention The external 32.768 kHz crystal oscillator must be enabled and stable prior
+ *            to initializing the calibrator. If the RTC PIT is not already running from
+ *            the external 32.768 kHz crystal oscillator, the calibrator reconfigures it.
+ */
+template<typename Clock_Plan, typename TCB_Instance, Peripheral::EVSYS::CHANNEL_Index EVSYS_CHANNEL>
+class Internal_16_20_MHz_Oscillator_Calibrator {
+  public:
+    static_assert(
+        Clock_Plan::SOURCE == Source::INTERNAL_16_20_MHz_OSCILLATOR,
+        "clock plan does not use the internal 16/20 MHz oscillator" );
+    static_assert(
+        EVSYS_CHANNEL & 0x1,
+        "the RTC PIT 64 cycle divided event is only available on odd channels" );
+
+    /**
+     * \brief The TCB clock prescaler divisor.
+     */
+    static constexpr auto TCB_PRESCALER_DIVISOR = std::uint_fast8_t{
+        Clock_Plan::CLK_PER_FREQUENCY / 512 > 0x7FFF ? 2 : 1
+    };
+
+    /**
+     * \brief The expected TCB capture value (reference clock period in TCB clock
+     *        cycles).
+     */
+    static constexpr auto TARGET_COUNT = static_cast<std::uint16_t>(
+        ( Clock_Plan::CLK_PER_FREQUENCY / TCB_PRESCALER_DIVISOR + 256 ) / 512 );
+
+    /**
+     * \brief The capture value error (in TCB clock cycles) that background tracking
+     *        tolerates before adjusting the calibration value.
+     */
+    static constexpr auto TRACKING_TOLERANCE = static_cast<std::uint16_t>(
+        TARGET_COUNT / 128 );
+
+    Internal_16_20_MHz_Oscillator_Calibrator() = delete;
+
+    /**
+     * \brief Initialize the calibrator's hardware.
+     *
+     * \pre if the RTC PIT is not already running from the external 32.768 kHz crystal
+     *      oscillator, the RTC counter is not enabled (changing the RTC clock source
+     *      would retime it)
+     */
+    static void initialize() noexcept
+    {
+        auto & rtc = Peripheral::RTC0::instance();
+
+        if ( not( rtc.pitctrla & Peripheral::RTC::PITCTRLA::Mask::PITEN )
+             or ( rtc.clksel & Peripheral::RTC::CLKSEL::Mask::CLKSEL )
+                    != Peripheral::RTC::CLKSEL::CLKSEL_TOSC32K ) {
+            PICOLIBRARY_EXPECT( not( rtc.ctrla & Peripheral::RTC::CTRLA::Mask::RTCEN ),
+                                Generic_Error::LOGIC_ERROR );
+
+            // PITCTRLA writes are ignored while the PIT is synchronizing a previous write
+            while ( rtc.pitstatus & Peripheral::RTC::PITSTATUS::Mask::CTRLBUSY ) {
+            } // while
+
+            rtc.pitctrla = 0;
+
+            while ( rtc.pitstatus & Peripheral::RTC::PITSTATUS::Mask::CTRLBUSY ) {
+            } // while
+
+            rtc.clksel = Peripheral::RTC::CLKSEL::CLKSEL_TOSC32K;
+
+            while ( rtc.pitstatus & Peripheral::RTC::PITSTATUS::Mask::CTRLBUSY ) {
+            } // while
+
+            rtc.pitctrla = Peripheral::RTC::PITCTRLA::Mask::PITEN;
+        } // if
+
+        auto & evsys = Peripheral::EVSYS0::instance();
+
+        evsys.channel[ EVSYS_CHANNEL ] = Peripheral::EVSYS::CHANNEL::GENERATOR_RTC_PIT3;
+        evsys.user[ EVSYS_USER ] = Peripheral::EVSYS::USER::CHANNEL_CHANNEL0
+                                   + EVSYS_CHANNEL;
+
+        auto & tcb = TCB_Instance::instance();
+
+        tcb.ctrla    = 0;
+        tcb.ctrlb    = Peripheral::TCB::CTRLB::CNTMODE_FRQ;
+        tcb.evctrl   = Peripheral::TCB::EVCTRL::Mask::CAPTEI;
+        tcb.intctrl  = 0;
+        tcb.intflags = Peripheral::TCB::INTFLAGS::Mask::CAPT;
+        tcb.ctrla    = TCB_CLKSEL | Peripheral::TCB::CTRLA::Mask::ENABLE;
+    }
+
+    /**
+     * \brief Disable the calibrator's hardware.
+     *
+     * \remark The RTC PIT is left running since it may be shared.
+     */
+    static void disable() noexcept
+    {
+        auto & tcb = TCB_Instance::instance();
+
+        tcb.intctrl = 0;
+        tcb.ctrla   = 0;
+
+        Peripheral::EVSYS0::instance().user[ EVSYS_USER ] =
+            Peripheral::EVSYS::USER::CHANNEL_NONE;
+    }
+
+    /**
+     * \brief Measure the reference clock period.
+     *
+     * \attention Background tracking must be disabled while this function is executing.
+     *
+     * \return The reference clock period in TCB clock cycles.
+     */
+    static auto measure() noexcept -> std::uint16_t
+    {
+        auto & tcb = TCB_Instance::instance();
+
+        // the first capture may span a calibration value change, so it is discarded
+        for ( auto capture = std::uint_fast8_t{}; capture < 2; ++capture ) {
+            tcb.intflags = Peripheral::TCB::INTFLAGS::Mask::CAPT;
+
+            while ( not( tcb.intflags & Peripheral::TCB::INTFLAGS::Mask::CAPT ) ) {
+            } // while
+        } // for
+
+        return tcb.ccmp;
+    }
+
+    /**
+     * \brief Calibrate the internal 16/20 MHz oscillator (binary search of the
+     *        calibration value).
+     *
+     * \pre not
+     *      picolibrary::Microchip::megaAVR0::Clock::internal_16_20_MHz_oscillator_calibration_locked()
+     *
+     * \attention Background tracking must be disabled while this function is executing.
+     */
+    static void calibrate() noexcept
+    {
+        PICOLIBRARY_EXPECT(
+            not internal_16_20_MHz_oscillator_calibration_locked(),
+            Generic_Error::LOGIC_ERROR );
+
+        auto low  = std::uint_fast8_t{};
+        auto high = std::uint_fast8_t{ Peripheral::CLKCTRL::OSC20MCALIBA::Mask::CAL20M };
+
+        // find the lowest calibration value that does not produce a frequency below the
+        // target frequency
+        while ( low < high ) {
+            auto const middle = static_cast<std::uint_fast8_t>( ( low + high ) / 2 );
+
+            set_calibration_value( middle );
+
+            if ( measure() < TARGET_COUNT ) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            } // else
+        }     // while
+
+        set_calibration_value( low );
+
+        if ( low ) {
+            auto const error = distance( measure() );
+
+            set_calibration_value( low - 1 );
+
+            if ( distance( measure() ) > error ) {
+                set_calibration_value( low );
+            } // if
+        }     // if
+    }
+
+    /**
+     * \brief Enable background tracking.
+     *
+     * Once enabled,
+     * picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Calibrator::track()
+     * must be called from the TCB's interrupt handler.
+     */
+    static void enable_tracking() noexcept
+    {
+        auto & tcb = TCB_Instance::instance();
+
+        m_discard_capture = true;
+
+        tcb.intflags = Peripheral::TCB::INTFLAGS::Mask::CAPT;
+        tcb.intctrl  = Peripheral::TCB::INTCTRL::Mask::CAPT;
+    }
+
+    /**
+     * \brief Disable background tracking.
+     */
+    static void disable_tracking() noexcept
+    {
+        TCB_Instance::instance().intctrl = 0;
+    }
+
+    /**
+     * \brief Adjust the calibration value by a single step if the most recent
+     *        measurement is outside of the tracking tolerance.
+     *
+     * \attention This function must be called from the TCB's interrupt handler.
+     */
+    static void track() noexcept
+    {
+        auto & tcb = TCB_Instance::instance();
+
+        std::uint16_t const count = tcb.ccmp;
+
+        tcb.intflags = Peripheral::TCB::INTFLAGS::Mask::CAPT;
+
+        if ( m_discard_capture ) {
+            m_discard_capture = false;
+
+            return;
+        } // if
+
+        auto const value = calibration_value();
+
+        if ( count > TARGET_COUNT + TRACKING_TOLERANCE and value > 0 ) {
+            set_calibration_value( value - 1 );
+
+            m_discard_capture = true;
+        } else if (
+            count < TARGET_COUNT - TRACKING_TOLERANCE
+            and value < Peripheral::CLKCTRL::OSC20MCALIBA::Mask::CAL20M ) {
+            set_calibration_value( value + 1 );
+
+            m_discard_capture = true;
+        } // else if
+    }
+
+    /**
+     * \brief Get the internal 16/20 MHz oscillator's calibration value.
+     *
+     * \return The internal 16/20 MHz oscillator's calibration value.
+     */
+    static auto calibration_value() noexcept -> std::uint_fast8_t
+    {
+        return Peripheral::CLKCTRL0::instance().osc20mcaliba
+               & Peripheral::CLKCTRL::OSC20MCALIBA::Mask::CAL20M;
+    }
+
+  private:
+    /**
+     * \brief The TCB's event system user register array index.
+     */
+    static constexpr auto EVSYS_USER = static_cast<Peripheral::EVSYS::USER_Index>(
+        Peripheral::EVSYS::USER_TCB0
+        + ( TCB_Instance::ADDRESS - Peripheral::TCB0::ADDRESS )
+              / ( Peripheral::TCB1::ADDRESS - Peripheral::TCB0::ADDRESS ) );
+
+    /**
+     * \brief The TCB clock selection.
+     */
+    static constexpr auto TCB_CLKSEL = std::uint8_t{
+        TCB_PRESCALER_DIVISOR == 2 ? Peripheral::TCB::CTRLA::CLKSEL_CLKDIV2
+                                   : Peripheral::TCB::CTRLA::CLKSEL_CLKDIV1
+    };
+
+    /**
+     * \brief Discard the next capture (set when the capture spans a calibration value
+     *        change).
+     */
+    static inline bool m_discard_capture{};
+
+    /**
+     * \brief Set the internal 16/20 MHz oscillator's calibration value.
+     *
+     * \param[in] value The desired calibration value.
+     */
+    static void set_calibration_value( std::uint_fast8_t value ) noexcept
+    {
+        Peripheral::CLKCTRL0::instance().osc20mcaliba = value;
+    }
+
+    /**
+     * \brief Get the distance between a capture value and the expected capture value.
+     *
+     * \param[in] count The capture value.
+     *
+     * \return The distance between the capture value and the expected capture value.
+     */
+    static constexpr auto distance( std::uint16_t count ) noexcept -> std::uint16_t
+    {
+        return count > TARGET_COUNT ? count - TARGET_COUNT : TARGET_COUNT - count;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::Clock
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_CALIBRATION_H
@@ -0,0 +1,528 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Clock::Plan interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_PLAN_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_PLAN_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/adc.h"
+#include "picolibrary/microchip/megaavr0/asynchronous_serial.h"
+#include "picolibrary/microchip/megaavr0/clock.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/peripheral/fuse.h"
+#include "picolibrary/microchip/megaavr0/peripheral/tca.h"
+#include "picolibrary/microchip/megaavr0/peripheral/tcb.h"
+#include "picolibrary/microchip/megaavr0/spi.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Microchip::megaAVR0::Clock {
+
+/**
+ * \brief Internal 16/20 MHz oscillator frequency (FUSE.OSCCFG register FREQSEL field
+ *        value).
+ */
+enum class Internal_16_20_MHz_Oscillator_Frequency : std::uint8_t {
+    _16_MHz = 0x1 << Peripheral::FUSE::OSCCFG::Bit::FREQSEL, ///< 16 MHz.
+    _20_MHz = 0x2 << Peripheral::FUSE::OSCCFG::Bit::FREQSEL, ///< 20 MHz.
+};
+
+/**
+ * \brief TCA clock prescaler.
+ */
+enum class TCA_Clock_Prescaler : std::uint8_t {
+    _1    = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV1,    ///< 1.
+    _2    = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV2,    ///< 2.
+    _4    = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV4,    ///< 4.
+    _8    = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV8,    ///< 8.
+    _16   = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV16,   ///< 16.
+    _64   = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV64,   ///< 64.
+    _256  = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV256,  ///< 256.
+    _1024 = Peripheral::TCA::Normal::CTRLA::CLKSEL_DIV1024, ///< 1024.
+};
+
+/**
+ * \brief TCB clock prescaler.
+ */
+enum class TCB_Clock_Prescaler : std::uint8_t {
+    _1 = Peripheral::TCB::CTRLA::CLKSEL_CLKDIV1, ///< 1.
+    _2 = Peripheral::TCB::CTRLA::CLKSEL_CLKDIV2, ///< 2.
+};
+
+/**
+ * \brief Get the frequency of a clock source.
+ *
+ * \param[in] source The clock source.
+ * \param[in] internal_16_20_MHz_oscillator_frequency The internal 16/20 MHz oscillator
+ *            frequency.
+ * \param[in] external_clock_frequency The external clock frequency (Hz).
+ *
+ * \return The frequency (Hz) of the clock source.
+ */
+constexpr auto frequency(
+    Source                                  source,
+    Internal_16_20_MHz_Oscillator_Frequency internal_16_20_MHz_oscillator_frequency,
+    std::uint32_t external_clock_frequency ) noexcept -> std::uint32_t
+{
+    switch ( source ) {
+        case Source::INTERNAL_16_20_MHz_OSCILLATOR:
+            return internal_16_20_MHz_oscillator_frequency
+                           == Internal_16_20_MHz_Oscillator_Frequency::_16_MHz
+                       ? 16'000'000
+                       : 20'000'000;
+        case Source::INTERNAL_32_768_kHz_ULTRA_LOW_POWER_OSCILLATOR: return 32'768;
+        case Source::EXTERNAL_32_768_kHz_CRYSTAL_OSCILLATOR: return 32'768;
+        case Source::EXTERNAL_CLOCK: return external_clock_frequency;
+    } // switch
+
+    return 0;
+}
+
+/**
+ * \brief Get the divisor of a clock prescaler value.
+ *
+ * \param[in] value The clock prescaler value.
+ *
+ * \return The divisor of the clock prescaler value.
+ */
+constexpr auto divisor( Prescaler_Value value ) noexcept -> std::uint_fast8_t
+{
+    switch ( value ) {
+        case Prescaler_Value::_2: return 2;
+        case Prescaler_Value::_4: return 4;
+        case Prescaler_Value::_6: return 6;
+        case Prescaler_Value::_8: return 8;
+        case Prescaler_Value::_10: return 10;
+        case Prescaler_Value::_12: return 12;
+        case Prescaler_Value::_16: return 16;
+        case Prescaler_Value::_24: return 24;
+        case Prescaler_Value::_32: return 32;
+        case Prescaler_Value::_48: return 48;
+        case Prescaler_Value::_64: return 64;
+    } // switch
+
+    return 1;
+}
+
+/**
+ * \brief Get the divisor of a TCA clock prescaler.
+ *
+ * \param[in] prescaler The TCA clock prescaler.
+ *
+ * \return The divisor of the TCA clock prescaler.
+ */
+constexpr auto divisor( TCA_Clock_Prescaler prescaler ) noexcept -> std::uint_fast16_t
+{
+    switch ( prescaler ) {
+        case TCA_Clock_Prescaler::_1: return 1;
+        case TCA_Clock_Prescaler::_2: return 2;
+        case TCA_Clock_Prescaler::_4: return 4;
+        case TCA_Clock_Prescaler::_8: return 8;
+        case TCA_Clock_Prescaler::_16: return 16;
+        case TCA_Clock_Prescaler::_64: return 64;
+        case TCA_Clock_Prescaler::_256: return 256;
+        case TCA_Clock_Prescaler::_1024: return 1024;
+    } // switch
+
+    return 1;
+}
+
+/**
+ * \brief Compile-time clock plan.
+ *
+ * A clock plan derives the peripheral clock (CLK_PER) frequency from the main clock
+ * source, the internal 16/20 MHz oscillator frequency selection (FUSE.OSCCFG register
+ * FREQSEL field), and the clock prescaler configuration, and derives peripheral clock
+ * generator configurations from the peripheral clock frequency. Invalid or unachievable
+ * configurations are reported at compile-time.
+ *
+ * \tparam CLOCK_SOURCE The clock source.
+ * \tparam INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY The internal 16/20 MHz oscillator
+ *         frequency. Ignored if the clock source is not the internal 16/20 MHz
+ *         oscillator.
+ * \tparam PRESCALER_VALUE The clock prescaler value.
+ * \tparam PRESCALER The clock prescaler configuration.
+ * \tparam EXTERNAL_CLOCK_FREQUENCY The external clock frequency (Hz). Must be 0 if the
+ *         clock source is not the external clock.
+ */
+template<Source CLOCK_SOURCE, Internal_16_20_MHz_Oscillator_Frequency INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY, Prescaler_Value PRESCALER_VALUE, Prescaler PRESCALER, std::uint32_t EXTERNAL_CLOCK_FREQUENCY = 0>
+class Plan {
+  public:
+    static_assert(
+        CLOCK_SOURCE == Source::EXTERNAL_CLOCK
+            ? EXTERNAL_CLOCK_FREQUENCY > 0 and EXTERNAL_CLOCK_FREQUENCY <= 20'000'000
+            : EXTERNAL_CLOCK_FREQUENCY == 0,
+        "invalid external clock frequency" );
+
+    /**
+     * \brief The clock source.
+     */
+    static constexpr auto SOURCE = CLOCK_SOURCE;
+
+    /**
+     * \brief The clock source frequency (Hz).
+     */
+    static constexpr auto SOURCE_FREQUENCY = frequency(
+        SOURCE, INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY, EXTERNAL_CLOCK_FREQUENCY );
+
+    /**
+     * \brief The clock prescaler divisor.
+     */
+    static constexpr auto PRESCALER_DIVISOR = std::uint_fast8_t{
+        PRESCALER == Prescaler::ENABLED ? divisor( PRESCALER_VALUE ) : 1
+    };
+
+    /**
+     * \brief The peripheral clock (CLK_PER) frequency (Hz).
+     */
+    static constexpr auto CLK_PER_FREQUENCY = std::uint32_t{ SOURCE_FREQUENCY
+                                                             / PRESCALER_DIVISOR };
+
+    Plan() = delete;
+
+    /**
+     * \brief Configure the clock source and the clock prescaler.
+     *
+     * \attention The clock source must be enabled and stable prior to calling this
+     *            function.
+     */
+    static void configure() noexcept
+    {
+        set_source( SOURCE );
+        configure_prescaler( PRESCALER_VALUE, PRESCALER );
+
+        while ( source_changing() ) {} // while
+    }
+
+    /**
+     * \brief Check if the internal 16/20 MHz oscillator frequency selection fuse matches
+     *        the plan.
+     *
+     * \return true if the clock source is not the internal 16/20 MHz oscillator or the
+     *         internal 16/20 MHz oscillator frequency selection fuse matches the plan.
+     * \return false if the clock source is the internal 16/20 MHz oscillator and the
+     *         internal 16/20 MHz oscillator frequency selection fuse does not match the
+     *         plan.
+     */
+    static auto frequency_selection_fuse_matches() noexcept -> bool
+    {
+        if constexpr ( SOURCE != Source::INTERNAL_16_20_MHz_OSCILLATOR ) {
+            return true;
+        } else {
+            auto const & fuse = Peripheral::FUSE0::instance();
+
+            return ( fuse.osccfg & Peripheral::FUSE::OSCCFG::Mask::FREQSEL )
+                   == to_underlying( INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY );
+        } // else
+    }
+
+    /**
+     * \brief Get the USART clock generator scaling factor (BAUD register value) for
+     *        asynchronous operation.
+     *
+     * \tparam BAUD_RATE The desired baud rate.
+     * \tparam USART_CLOCK_GENERATOR_OPERATING_SPEED The USART clock generator operating
+     *         speed configuration.
+     *
+     * \return The USART clock generator scaling factor.
+     */
+    template<std::uint32_t BAUD_RATE, Asynchronous_Serial::USART_Clock_Generator_Operating_Speed USART_CLOCK_GENERATOR_OPERATING_SPEED>
+    static constexpr auto usart_clock_generator_scaling_factor() noexcept -> std::uint16_t
+    {
+        static_assert( BAUD_RATE > 0, "invalid baud rate" );
+
+        constexpr auto samples_per_bit = std::uint64_t{
+            USART_CLOCK_GENERATOR_OPERATING_SPEED
+                    == Asynchronous_Serial::USART_Clock_Generator_Operating_Speed::NORMAL
+                ? 16
+                : 8
+        };
+        constexpr auto bit_clocks = samples_per_bit * BAUD_RATE;
+        constexpr auto scaling_factor = ( 64 * std::uint64_t{ CLK_PER_FREQUENCY }
+                                          + bit_clocks / 2 )
+                                        / bit_clocks;
+
+        static_assert( scaling_factor >= 64, "baud rate too high for CLK_PER" );
+        static_assert( scaling_factor <= 0xFFFF, "baud rate too low for CLK_PER" );
+
+        constexpr auto actual = bit_clocks * scaling_factor;
+        constexpr auto desired = 64 * std::uint64_t{ CLK_PER_FREQUENCY };
+        constexpr auto error = actual > desired ? actual - desired : desired - actual;
+
+        static_assert( error * 50 <= desired, "baud rate error exceeds 2%" );
+
+        return scaling_factor;
+    }
+
+    /**
+     * \brief Get the USART clock generator scaling factor (BAUD register value) for SPI
+     *        host operation.
+     *
+     * The resulting SPI clock frequency is the highest achievable frequency that does not
+     * exceed the desired SPI clock frequency.
+     *
+     * \tparam SPI_CLOCK_FREQUENCY The desired SPI clock frequency (Hz).
+     *
+     * \return The USART clock generator scaling factor.
+     */
+    template<std::uint32_t SPI_CLOCK_FREQUENCY>
+    static constexpr auto usart_spi_clock_generator_scaling_factor() noexcept
+        -> std::uint16_t
+    {
+        static_assert( SPI_CLOCK_FREQUENCY > 0, "invalid SPI clock frequency" );
+
+        // the fractional part of the scaling factor is ignored in synchronous operation
+        constexpr auto divisor = ( std::uint64_t{ CLK_PER_FREQUENCY }
+                                   + 2 * SPI_CLOCK_FREQUENCY - 1 )
+                                 / ( 2 * std::uint64_t{ SPI_CLOCK_FREQUENCY } );
+
+        static_assert( divisor <= 0x3FF, "SPI clock frequency too low for CLK_PER" );
+
+        return ( divisor > 0 ? divisor : 1 ) << 6;
+    }
+
+    /**
+     * \brief Get the SPI clock rate.
+     *
+     * The resulting SPI clock frequency is the highest achievable frequency that does not
+     * exceed the desired SPI clock frequency.
+     *
+     * \tparam SPI_CLOCK_FREQUENCY The desired SPI clock frequency (Hz).
+     *
+     * \return The SPI clock rate.
+     */
+    template<std::uint32_t SPI_CLOCK_FREQUENCY>
+    static constexpr auto spi_clock_rate() noexcept -> SPI::SPI_Clock_Rate
+    {
+        static_assert(
+            fits<SPI_CLOCK_FREQUENCY>( 128 ), "SPI clock frequency too low for CLK_PER" );
+
+        if constexpr ( fits<SPI_CLOCK_FREQUENCY>( 2 ) ) {
+            return SPI::SPI_Clock_Rate::CLK_PER_2;
+        } else if constexpr ( fits<SPI_CLOCK_FREQUENCY>( 4 ) ) {
+            return SPI::SPI_Clock_Rate::CLK_PER_4;
+        } else if constexpr ( fits<SPI_CLOCK_FREQUENCY>( 8 ) ) {
+            return SPI::SPI_Clock_Rate::CLK_PER_8;
+        } else if constexpr ( fits<SPI_CLOCK_FREQUENCY>( 16 ) ) {
+            return SPI::SPI_Clock_Rate::CLK_PER_16;
+        } else if constexpr ( fits<SPI_CLOCK_FREQUENCY>( 32 ) ) {
+            return SPI::SPI_Clock_Rate::CLK_PER_32;
+        } else if constexpr ( fits<SPI_CLOCK_FREQUENCY>( 64 ) ) {
+            return SPI::SPI_Clock_Rate::CLK_PER_64;
+        } else {
+            return SPI::SPI_Clock_Rate::CLK_PER_128;
+        } // else
+    }
+
+    /**
+     * \brief Get the TWI clock generator scaling factor (MBAUD register value).
+     *
+     * The resulting SCL frequency is the highest achievable frequency that does not
+     * exceed the desired SCL frequency.
+     *
+     * \tparam SCL_FREQUENCY The desired SCL frequency (Hz).
+     * \tparam SCL_RISE_TIME The SCL rise time (ns).
+     *
+     * \return The TWI clock generator scaling factor.
+     */
+    template<std::uint32_t SCL_FREQUENCY, std::uint32_t SCL_RISE_TIME = 0>
+    static constexpr auto twi_clock_generator_scaling_factor() noexcept -> std::uint8_t
+    {
+        static_assert( SCL_FREQUENCY > 0, "invalid SCL frequency" );
+
+        // f_SCL = f_CLK_PER / ( 10 + 2 * MBAUD + f_CLK_PER * t_rise )
+        constexpr auto overhead = 10
+                                  + std::uint64_t{ CLK_PER_FREQUENCY } * SCL_RISE_TIME
+                                        / 1'000'000'000;
+        constexpr auto minimum_period = overhead * SCL_FREQUENCY;
+
+        static_assert(
+            minimum_period <= CLK_PER_FREQUENCY, "SCL frequency too high for CLK_PER" );
+
+        constexpr auto scaling_factor = ( CLK_PER_FREQUENCY - minimum_period
+                                          + 2 * SCL_FREQUENCY - 1 )
+                                        / ( 2 * std::uint64_t{ SCL_FREQUENCY } );
+
+        static_assert( scaling_factor <= 0xFF, "SCL frequency too low for CLK_PER" );
+
+        return scaling_factor;
+    }
+
+    /**
+     * \brief Get the TCA clock prescaler.
+     *
+     * The resulting TCA clock frequency is the highest achievable frequency that does not
+     * exceed the desired TCA clock frequency.
+     *
+     * \tparam TCA_CLOCK_FREQUENCY The desired TCA clock frequency (Hz).
+     *
+     * \return The TCA clock prescaler.
+     */
+    template<std::uint32_t TCA_CLOCK_FREQUENCY>
+    static constexpr auto tca_clock_prescaler() noexcept -> TCA_Clock_Prescaler
+    {
+        static_assert(
+            fits<TCA_CLOCK_FREQUENCY>( 1024 ),
+            "TCA clock frequency too low for CLK_PER" );
+
+        if constexpr ( fits<TCA_CLOCK_FREQUENCY>( 1 ) ) {
+            return TCA_Clock_Prescaler::_1;
+        } else if constexpr ( fits<TCA_CLOCK_FREQUENCY>( 2 ) ) {
+            return TCA_Clock_Prescaler::_2;
+        } else if constexpr ( fits<TCA_CLOCK_FREQUENCY>( 4 ) ) {
+            return TCA_Clock_Prescaler::_4;
+        } else if constexpr ( fits<TCA_CLOCK_FREQUENCY>( 8 ) ) {
+            return TCA_Clock_Prescaler::_8;
+        } else if constexpr ( fits<TCA_CLOCK_FREQUENCY>( 16 ) ) {
+            return TCA_Clock_Prescaler::_16;
+        } else if constexpr ( fits<TCA_CLOCK_FREQUENCY>( 64 ) ) {
+            return TCA_Clock_Prescaler::_64;
+        } else if constexpr ( fits<TCA_CLOCK_FREQUENCY>( 256 ) ) {
+            return TCA_Clock_Prescaler::_256;
+        } else {
+            return TCA_Clock_Prescaler::_1024;
+        } // else
+    }
+
+    /**
+     * \brief Get the TCA period (PER register value) that produces overflows (and
+     *        overflow events) at a frequency.
+     *
+     * The overflow period must be a whole number of TCA clock cycles so that the overflows
+     * are exactly the desired frequency apart.
+     *
+     * \tparam OVERFLOW_FREQUENCY The desired overflow frequency (Hz).
+     * \tparam TCA_CLOCK_PRESCALER The TCA clock prescaler.
+     *
+     * \return The TCA period.
+     */
+    template<std::uint32_t OVERFLOW_FREQUENCY, TCA_Clock_Prescaler TCA_CLOCK_PRESCALER>
+    static constexpr auto tca_period() noexcept -> std::uint16_t
+    {
+        static_assert( OVERFLOW_FREQUENCY > 0, "invalid overflow frequency" );
+
+        constexpr auto tca_clock_cycles = std::uint64_t{ divisor( TCA_CLOCK_PRESCALER ) }
+                                          * OVERFLOW_FREQUENCY;
+
+        static_assert(
+            CLK_PER_FREQUENCY % tca_clock_cycles == 0,
+            "overflow period is not a whole number of TCA clock cycles" );
+
+        constexpr auto period = CLK_PER_FREQUENCY / tca_clock_cycles;
+
+        static_assert( period >= 2, "overflow frequency too high for CLK_PER" );
+        static_assert( period <= 0x10000, "overflow frequency too low for CLK_PER" );
+
+        return period - 1;
+    }
+
+    /**
+     * \brief Get the number of peripheral clock cycles an event triggered ADC conversion
+     *        leaves idle before the next trigger.
+     *
+     * An event triggered conversion (including all accumulated conversions) must complete
+     * before the next event is received, otherwise the event is ignored and a sample is
+     * lost. One ADC clock cycle is allowed for start event synchronization.
+     *
+     * \tparam SAMPLE_RATE The desired sample (trigger event) rate (Hz).
+     * \tparam ADC_CLOCK_PRESCALER The ADC clock prescaler.
+     * \tparam ADC_RESOLUTION The ADC resolution.
+     * \tparam ADC_ACCUMULATION The ADC accumulation.
+     * \tparam ADC_SAMPLE_LENGTH The ADC sample length (SAMPCTRL register SAMPLEN field
+     *         value).
+     *
+     * \return The number of peripheral clock cycles between the completion of a
+     *         conversion and the next trigger event.
+     */
+    template<std::uint32_t SAMPLE_RATE, ADC::ADC_Clock_Prescaler ADC_CLOCK_PRESCALER, ADC::ADC_Resolution ADC_RESOLUTION, ADC::ADC_Accumulation ADC_ACCUMULATION = ADC::ADC_Accumulation::NONE, std::uint8_t ADC_SAMPLE_LENGTH = 0>
+    static constexpr auto adc_sampling_slack() noexcept -> std::uint32_t
+    {
+        static_assert( SAMPLE_RATE > 0, "invalid sample rate" );
+        static_assert(
+            ADC_SAMPLE_LENGTH <= ADC::ADC_SAMPLE_LENGTH_MAX, "invalid ADC sample length" );
+
+        constexpr auto adc_clock_divisor = ADC::divisor( ADC_CLOCK_PRESCALER );
+
+        static_assert(
+            fits<1'500'000>( adc_clock_divisor ), "ADC clock frequency too high for CLK_PER" );
+        static_assert(
+            CLK_PER_FREQUENCY / adc_clock_divisor >= 50'000,
+            "ADC clock frequency too low for CLK_PER" );
+
+        constexpr auto sample_period = CLK_PER_FREQUENCY / SAMPLE_RATE;
+        constexpr auto conversion_period = adc_clock_divisor
+                                           * ( std::uint32_t{ ADC::conversion_cycles(
+                                                   ADC_RESOLUTION, ADC_SAMPLE_LENGTH ) }
+                                                   * ADC::accumulated_conversions( ADC_ACCUMULATION )
+                                               + 1 );
+
+        static_assert(
+            conversion_period < sample_period, "sample rate too high for ADC configuration" );
+
+        return sample_period - conversion_period;
+    }
+
+    /**
+     * \brief Get the TCB clock prescaler.
+     *
+     * The resulting TCB clock frequency is the highest achievable frequency that does not
+     * exceed the desired TCB clock frequency.
+     *
+     * \tparam TCB_CLOCK_FREQUENCY The desired TCB clock frequency (Hz).
+     *
+     * \return The TCB clock prescaler.
+     */
+    template<std::uint32_t TCB_CLOCK_FREQUENCY>
+    static constexpr auto tcb_clock_prescaler() noexcept -> TCB_Clock_Prescaler
+    {
+        static_assert(
+            fits<TCB_CLOCK_FREQUENCY>( 2 ), "TCB clock frequency too low for CLK_PER" );
+
+        if constexpr ( fits<TCB_CLOCK_FREQUENCY>( 1 ) ) {
+            return TCB_Clock_Prescaler::_1;
+        } else {
+            return TCB_Clock_Prescaler::_2;
+        } // else
+    }
+
+  private:
+    /**
+     * \brief Check if dividing the peripheral clock by a divisor produces a frequency
+     *        that does not exceed a maximum frequency.
+     *
+     * \tparam MAXIMUM_FREQUENCY The maximum frequency (Hz).
+     *
+     * \param[in] divisor The divisor.
+     *
+     * \return true if the resulting frequency does not exceed the maximum frequency.
+     * \return false if the resulting frequency exceeds the maximum frequency.
+     */
+    template<std::uint32_t MAXIMUM_FREQUENCY>
+    static constexpr auto fits( std::uint_fast16_t divisor ) noexcept -> bool
+    {
+        return CLK_PER_FREQUENCY <= std::uint64_t{ MAXIMUM_FREQUENCY } * divisor;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::Clock
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_PLAN_H
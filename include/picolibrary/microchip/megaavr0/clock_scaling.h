@@ -0,0 +1,214 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Clock::Scaler interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_SCALING_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_SCALING_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/asynchronous_serial.h"
+#include "picolibrary/microchip/megaavr0/clock_plan.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral/spi.h"
+#include "picolibrary/microchip/megaavr0/peripheral/twi.h"
+#include "picolibrary/microchip/megaavr0/spi.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Microchip::megaAVR0::Clock {
+
+/**
+ * \brief Asynchronous USART retimer.
+ *
+ * \tparam USART_Instance The USART peripheral instance to retime (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::USART0).
+ * \tparam BAUD_RATE The desired baud rate.
+ * \tparam USART_CLOCK_GENERATOR_OPERATING_SPEED The USART clock generator operating speed
+ *         configuration.
+ */
+template<typename USART_Instance, std::uint32_t BAUD_RATE, Asynchronous_Serial::USART_Clock_Generator_Operating_Speed USART_CLOCK_GENERATOR_OPERATING_SPEED>
+class USART_Retimer {
+  public:
+    USART_Retimer() = delete;
+
+    /**
+     * \brief Update the USART's clock generator scaling factor (BAUD register value) to
+     *        match a clock plan.
+     *
+     * \tparam Plan The clock plan.
+     */
+    template<typename Plan>
+    static void retime() noexcept
+    {
+        USART_Instance::instance().baud = Plan::template usart_clock_generator_scaling_factor<
+            BAUD_RATE,
+            USART_CLOCK_GENERATOR_OPERATING_SPEED>();
+    }
+};
+
+/**
+ * \brief USART SPI controller retimer.
+ *
+ * \tparam USART_Instance The USART peripheral instance to retime (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::USART0).
+ * \tparam SPI_CLOCK_FREQUENCY The desired SPI clock frequency (Hz).
+ */
+template<typename USART_Instance, std::uint32_t SPI_CLOCK_FREQUENCY>
+class USART_SPI_Retimer {
+  public:
+    USART_SPI_Retimer() = delete;
+
+    /**
+     * \brief Update the USART's clock generator scaling factor (BAUD register value) to
+     *        match a clock plan.
+     *
+     * \tparam Plan The clock plan.
+     */
+    template<typename Plan>
+    static void retime() noexcept
+    {
+        USART_Instance::instance().baud =
+            Plan::template usart_spi_clock_generator_scaling_factor<SPI_CLOCK_FREQUENCY>();
+    }
+};
+
+/**
+ * \brief SPI controller retimer.
+ *
+ * \tparam SPI_Instance The SPI peripheral instance to retime (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::SPI0).
+ * \tparam SPI_CLOCK_FREQUENCY The desired SPI clock frequency (Hz).
+ */
+template<typename SPI_Instance, std::uint32_t SPI_CLOCK_FREQUENCY>
+class SPI_Retimer {
+  public:
+    SPI_Retimer() = delete;
+
+    /**
+     * \brief Update the SPI's clock rate to match a clock plan.
+     *
+     * \tparam Plan The clock plan.
+     */
+    template<typename Plan>
+    static void retime() noexcept
+    {
+        auto & spi = SPI_Instance::instance();
+
+        spi.ctrla = ( spi.ctrla
+                      & ~( Peripheral::SPI::CTRLA::Mask::CLK2X
+                           | Peripheral::SPI::CTRLA::Mask::PRESC ) )
+                    | to_underlying( Plan::template spi_clock_rate<SPI_CLOCK_FREQUENCY>() );
+    }
+};
+
+/**
+ * \brief TWI controller retimer.
+ *
+ * \tparam TWI_Instance The TWI peripheral instance to retime (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::TWI0).
+ * \tparam SCL_FREQUENCY The desired SCL frequency (Hz).
+ * \tparam SCL_RISE_TIME The SCL rise time (ns).
+ */
+template<typename TWI_Instance, std::uint32_t SCL_FREQUENCY, std::uint32_t SCL_RISE_TIME = 0>
+class TWI_Retimer {
+  public:
+    TWI_Retimer() = delete;
+
+    /**
+     * \brief Update the TWI's clock generator scaling factor (MBAUD register value) to
+     *        match a clock plan.
+     *
+     * \attention The MBAUD register can only be written while the controller is
+     *            disabled. If the controller is enabled, it is disabled while the MBAUD
+     *            register is written, and its bus state is forced to idle once it has been
+     *            re-enabled.
+     *
+     * \tparam Plan The clock plan.
+     */
+    template<typename Plan>
+    static void retime() noexcept
+    {
+        auto & twi = TWI_Instance::instance();
+
+        std::uint8_t const mctrla = twi.mctrla;
+
+        twi.mctrla = mctrla & ~Peripheral::TWI::MCTRLA::Mask::ENABLE;
+        twi.mbaud = Plan::template twi_clock_generator_scaling_factor<SCL_FREQUENCY, SCL_RISE_TIME>();
+        twi.mctrla = mctrla;
+
+        if ( mctrla & Peripheral::TWI::MCTRLA::Mask::ENABLE ) {
+            twi.mstatus = Peripheral::TWI::MSTATUS::BUSSTATE_IDLE;
+        } // if
+    }
+};
+
+/**
+ * \brief Clock scaler.
+ *
+ * \tparam Retimers The retimers of the peripherals whose clock generators depend on the
+ *         peripheral clock (CLK_PER) frequency (e.g.
+ *         picolibrary::Microchip::megaAVR0::Clock::USART_Retimer,
+ *         picolibrary::Microchip::megaAVR0::Clock::USART_SPI_Retimer,
+ *         picolibrary::Microchip::megaAVR0::Clock::SPI_Retimer, and
+ *         picolibrary::Microchip::megaAVR0::Clock::TWI_Retimer).
+ *
+ * Retimers are registered at compile-time, so each plan's peripheral clock generator
+ * configurations are computed (and checked) at compile-time and scaling to a plan
+ * reduces to a sequence of register writes.
+ *
+ * \attention Any transfers that are in progress when the clock is scaled will be
+ *            corrupted. Transfers should be allowed to complete before scaling the clock.
+ */
+template<typename... Retimers>
+class Scaler {
+  public:
+    Scaler() = delete;
+
+    /**
+     * \brief Scale the clock to match a clock plan, and update the clock generators of
+     *        the registered peripherals to match the plan.
+     *
+     * \attention The plan's clock source must be enabled and stable prior to calling this
+     *            function.
+     *
+     * \tparam Plan The clock plan (picolibrary::Microchip::megaAVR0::Clock::Plan).
+     */
+    template<typename Plan>
+    static void scale() noexcept
+    {
+        Interrupt::Controller interrupt_controller;
+
+        auto const interrupt_enable_state =
+            interrupt_controller.save_interrupt_enable_state();
+
+        interrupt_controller.disable_interrupt();
+
+        Plan::configure();
+
+        ( Retimers::template retime<Plan>(), ... );
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::Clock
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_CLOCK_SCALING_H
@@ -0,0 +1,327 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Debounce interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_DEBOUNCE_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_DEBOUNCE_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/peripheral/rtc.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Microchip megaAVR 0-series debounce facilities.
+ */
+namespace picolibrary::Microchip::megaAVR0::Debounce {
+
+/**
+ * \brief RTC periodic interrupt timer (PIT) clock source.
+ */
+enum class PIT_Clock_Source : std::uint8_t {
+    INTERNAL_32_768_kHz_OSCILLATOR = Peripheral::RTC::CLKSEL::CLKSEL_INT32K, ///< Internal 32.768 kHz oscillator.
+    INTERNAL_1_024_kHz_OSCILLATOR = Peripheral::RTC::CLKSEL::CLKSEL_INT1K, ///< Internal 1.024 kHz oscillator.
+    EXTERNAL_32_768_kHz_CRYSTAL_OSCILLATOR = Peripheral::RTC::CLKSEL::CLKSEL_TOSC32K, ///< External 32.768 kHz crystal oscillator.
+    EXTERNAL_CLOCK = Peripheral::RTC::CLKSEL::CLKSEL_EXTCLK, ///< External clock.
+};
+
+/**
+ * \brief RTC periodic interrupt timer (PIT) period.
+ */
+enum class PIT_Period : std::uint8_t {
+    _4_CYCLES     = Peripheral::RTC::PITCTRLA::PERIOD_CYC4,     ///< 4 cycles.
+    _8_CYCLES     = Peripheral::RTC::PITCTRLA::PERIOD_CYC8,     ///< 8 cycles.
+    _16_CYCLES    = Peripheral::RTC::PITCTRLA::PERIOD_CYC16,    ///< 16 cycles.
+    _32_CYCLES    = Peripheral::RTC::PITCTRLA::PERIOD_CYC32,    ///< 32 cycles.
+    _64_CYCLES    = Peripheral::RTC::PITCTRLA::PERIOD_CYC64,    ///< 64 cycles.
+    _128_CYCLES   = Peripheral::RTC::PITCTRLA::PERIOD_CYC128,   ///< 128 cycles.
+    _256_CYCLES   = Peripheral::RTC::PITCTRLA::PERIOD_CYC256,   ///< 256 cycles.
+    _512_CYCLES   = Peripheral::RTC::PITCTRLA::PERIOD_CYC512,   ///< 512 cycles.
+    _1024_CYCLES  = Peripheral::RTC::PITCTRLA::PERIOD_CYC1024,  ///< 1024 cycles.
+    _2048_CYCLES  = Peripheral::RTC::PITCTRLA::PERIOD_CYC2048,  ///< 2048 cycles.
+    _4096_CYCLES  = Peripheral::RTC::PITCTRLA::PERIOD_CYC4096,  ///< 4096 cycles.
+    _8192_CYCLES  = Peripheral::RTC::PITCTRLA::PERIOD_CYC8192,  ///< 8192 cycles.
+    _16384_CYCLES = Peripheral::RTC::PITCTRLA::PERIOD_CYC16384, ///< 16384 cycles.
+    _32768_CYCLES = Peripheral::RTC::PITCTRLA::PERIOD_CYC32768, ///< 32768 cycles.
+};
+
+/**
+ * \brief Debounced input sampler.
+ *
+ * \tparam VPORT_Instances The GPIO virtual port instances whose inputs are debounced
+ *         (e.g. picolibrary::Microchip::megaAVR0::Peripheral::VPORTA).
+ *
+ * The sampler snapshots each virtual port's IN register on every RTC periodic interrupt
+ * timer (PIT) tick and filters all 8 pins of a port at once using a 2-bit vertical
+ * counter. A pin's debounced state changes once its sampled state has differed from its
+ * debounced state for 4 consecutive ticks.
+ *
+ * The sampler's picolibrary::Microchip::megaAVR0::Debounce::Sampler::sample() member
+ * function must be called from the RTC peripheral's PIT interrupt handler
+ * (RTC_PIT_vect).
+ *
+ * Ports are identified by their index in the VPORT_Instances template parameter pack.
+ */
+template<typename... VPORT_Instances>
+class Sampler {
+  public:
+    static_assert( sizeof...( VPORT_Instances ) > 0 );
+
+    /**
+     * \brief The number of ports whose inputs are debounced.
+     */
+    static constexpr auto PORTS = std::uint_fast8_t{ sizeof...( VPORT_Instances ) };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Sampler() noexcept = default;
+
+    Sampler( Sampler && ) = delete;
+
+    Sampler( Sampler const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Sampler() noexcept
+    {
+        disable();
+    }
+
+    auto operator=( Sampler && ) = delete;
+
+    auto operator=( Sampler const & ) = delete;
+
+    /**
+     * \brief Initialize the sampler's state and start the RTC periodic interrupt timer
+     *        (PIT).
+     *
+     * The debounced state of each pin is initialized to the pin's current state.
+     *
+     * If the PIT is already running from the requested clock source (e.g. because it is
+     * shared with
+     * picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Calibrator),
+     * the RTC clock selection is left unchanged and only the PIT period is updated.
+     *
+     * \pre if the PIT is not already running from the requested clock source, the RTC
+     *      counter is not enabled (changing the RTC clock source would retime it)
+     *
+     * \param[in] clock_source The PIT clock source.
+     * \param[in] period The PIT period (sample interval).
+     */
+    void initialize( PIT_Clock_Source clock_source, PIT_Period period ) noexcept
+    {
+        std::uint8_t const samples[]{ VPORT_Instances::instance().in... };
+
+        for ( auto port = std::uint_fast8_t{}; port < PORTS; ++port ) {
+            m_state[ port ]         = samples[ port ];
+            m_counter_low[ port ]   = 0;
+            m_counter_high[ port ]  = 0;
+            m_rising_edges[ port ]  = 0;
+            m_falling_edges[ port ] = 0;
+        } // for
+
+        auto & rtc = Peripheral::RTC0::instance();
+
+        // PITCTRLA writes are ignored while the PIT is synchronizing a previous write
+        while ( rtc.pitstatus & Peripheral::RTC::PITSTATUS::Mask::CTRLBUSY ) {} // while
+
+        if ( not( rtc.pitctrla & Peripheral::RTC::PITCTRLA::Mask::PITEN )
+             or ( rtc.clksel & Peripheral::RTC::CLKSEL::Mask::CLKSEL )
+                    != to_underlying( clock_source ) ) {
+            PICOLIBRARY_EXPECT( not( rtc.ctrla & Peripheral::RTC::CTRLA::Mask::RTCEN ),
+                                Generic_Error::LOGIC_ERROR );
+
+            rtc.pitctrla = 0;
+
+            while ( rtc.pitstatus & Peripheral::RTC::PITSTATUS::Mask::CTRLBUSY ) {
+            } // while
+
+            rtc.clksel = to_underlying( clock_source );
+
+            while ( rtc.pitstatus & Peripheral::RTC::PITSTATUS::Mask::CTRLBUSY ) {
+            } // while
+        } // if
+
+        rtc.pitctrla = to_underlying( period ) | Peripheral::RTC::PITCTRLA::Mask::PITEN;
+
+        rtc.pitintflags = Peripheral::RTC::PITINTFLAGS::Mask::PI;
+        rtc.pitintctrl  = Peripheral::RTC::PITINTCTRL::Mask::PI;
+    }
+
+    /**
+     * \brief Sample and filter the inputs.
+     *
+     * \attention This function must not be interrupted by a call to any of the sampler's
+     *            edge accessors (call it from the RTC peripheral's PIT interrupt
+     *            handler).
+     */
+    void sample() noexcept
+    {
+        Peripheral::RTC0::instance().pitintflags = Peripheral::RTC::PITINTFLAGS::Mask::PI;
+
+        std::uint8_t const samples[]{ VPORT_Instances::instance().in... };
+
+        for ( auto port = std::uint_fast8_t{}; port < PORTS; ++port ) {
+            std::uint8_t const state = m_state[ port ];
+            std::uint8_t const delta = samples[ port ] ^ state;
+
+            // counters of pins whose sampled state matches their debounced state are
+            // reset, all other counters are incremented (modulo 4)
+            std::uint8_t const counter_low = ~m_counter_low[ port ] & delta;
+            std::uint8_t const counter_high =
+                ( m_counter_high[ port ] ^ m_counter_low[ port ] ) & delta;
+
+            // a pin's debounced state toggles when its counter wraps back to 0
+            std::uint8_t const changes = delta & ~counter_low & ~counter_high;
+
+            m_counter_low[ port ]  = counter_low;
+            m_counter_high[ port ] = counter_high;
+            m_state[ port ]        = state ^ changes;
+
+            m_rising_edges[ port ]  = m_rising_edges[ port ] | ( changes & ~state );
+            m_falling_edges[ port ] = m_falling_edges[ port ] | ( changes & state );
+        } // for
+    }
+
+    /**
+     * \brief Get a port's debounced pin states.
+     *
+     * \pre port < picolibrary::Microchip::megaAVR0::Debounce::Sampler::PORTS
+     *
+     * \param[in] port The index of the port.
+     *
+     * \return The port's debounced pin states.
+     */
+    auto state( std::uint_fast8_t port ) const noexcept -> std::uint8_t
+    {
+        PICOLIBRARY_EXPECT( port < PORTS, Generic_Error::INVALID_ARGUMENT );
+
+        return m_state[ port ];
+    }
+
+    /**
+     * \brief Get and clear the debounced rising edges (low to high transitions) that
+     *        have occurred on a port's pins since the port's rising edges were last
+     *        cleared.
+     *
+     * \pre port < picolibrary::Microchip::megaAVR0::Debounce::Sampler::PORTS
+     *
+     * \param[in] port The index of the port.
+     *
+     * \return The mask identifying the port's pins that have had a debounced rising edge.
+     */
+    auto take_rising_edges( std::uint_fast8_t port ) noexcept -> std::uint8_t
+    {
+        PICOLIBRARY_EXPECT( port < PORTS, Generic_Error::INVALID_ARGUMENT );
+
+        return take( m_rising_edges[ port ] );
+    }
+
+    /**
+     * \brief Get and clear the debounced falling edges (high to low transitions) that
+     *        have occurred on a port's pins since the port's falling edges were last
+     *        cleared.
+     *
+     * \pre port < picolibrary::Microchip::megaAVR0::Debounce::Sampler::PORTS
+     *
+     * \param[in] port The index of the port.
+     *
+     * \return The mask identifying the port's pins that have had a debounced falling
+     *         edge.
+     */
+    auto take_falling_edges( std::uint_fast8_t port ) noexcept -> std::uint8_t
+    {
+        PICOLIBRARY_EXPECT( port < PORTS, Generic_Error::INVALID_ARGUMENT );
+
+        return take( m_falling_edges[ port ] );
+    }
+
+  private:
+    /**
+     * \brief The debounced pin states.
+     */
+    std::uint8_t volatile m_state[ PORTS ]{};
+
+    /**
+     * \brief The low bits of the vertical counters.
+     */
+    std::uint8_t m_counter_low[ PORTS ]{};
+
+    /**
+     * \brief The high bits of the vertical counters.
+     */
+    std::uint8_t m_counter_high[ PORTS ]{};
+
+    /**
+     * \brief The debounced rising edges that have not been cleared.
+     */
+    std::uint8_t volatile m_rising_edges[ PORTS ]{};
+
+    /**
+     * \brief The debounced falling edges that have not been cleared.
+     */
+    std::uint8_t volatile m_falling_edges[ PORTS ]{};
+
+    /**
+     * \brief Get and clear a set of edges.
+     *
+     * \param[in] edges The set of edges to get and clear.
+     *
+     * \return The set of edges.
+     */
+    static auto take( std::uint8_t volatile & edges ) noexcept -> std::uint8_t
+    {
+        Interrupt::Controller interrupt_controller;
+
+        auto const interrupt_enable_state =
+            interrupt_controller.save_interrupt_enable_state();
+
+        interrupt_controller.disable_interrupt();
+
+        std::uint8_t const value = edges;
+
+        edges = 0;
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+
+        return value;
+    }
+
+    /**
+     * \brief Disable the RTC periodic interrupt timer (PIT) interrupt.
+     *
+     * \remark The RTC PIT is left running since it may be shared.
+     */
+    void disable() noexcept
+    {
+        Peripheral::RTC0::instance().pitintctrl = 0;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::Debounce
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_DEBOUNCE_H
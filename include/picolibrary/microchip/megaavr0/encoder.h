@@ -0,0 +1,202 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Encoder interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_ENCODER_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_ENCODER_H
+
+#include <cstdint>
+
+#include "picolibrary/array.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+
+/**
+ * \brief Microchip megaAVR 0-series encoder facilities.
+ */
+namespace picolibrary::Microchip::megaAVR0::Encoder {
+
+/**
+ * \brief Quadrature state transition table.
+ *
+ * The table is indexed by ( previous state << 2 ) | current state, where a state is
+ * ( A << 1 ) | B. Each entry is the position change associated with the transition (+1
+ * for a forward step, -1 for a reverse step, and 0 for no change or an invalid
+ * transition that skipped a state).
+ */
+using Quadrature_Transition_Table = ::picolibrary::Array<std::int_fast8_t, 16>;
+
+/**
+ * \brief Generate the quadrature state transition table.
+ *
+ * The forward state sequence is 0b00, 0b01, 0b11, 0b10 (B leads A).
+ *
+ * \return The quadrature state transition table.
+ */
+constexpr auto generate_quadrature_transition_table() noexcept
+    -> Quadrature_Transition_Table
+{
+    // index of each state in the forward state sequence
+    constexpr std::uint_fast8_t sequence_index[]{ 0, 1, 3, 2 };
+
+    auto table = Quadrature_Transition_Table{};
+
+    for ( auto previous = std::uint_fast8_t{}; previous < 4; ++previous ) {
+        for ( auto current = std::uint_fast8_t{}; current < 4; ++current ) {
+            auto const steps = ( sequence_index[ current ] - sequence_index[ previous ] )
+                               & 0x3;
+
+            table[ ( previous << 2 ) | current ] = steps == 1 ? 1 : steps == 3 ? -1 : 0;
+        } // for
+    }     // for
+
+    return table;
+}
+
+static_assert( generate_quadrature_transition_table()[ 0b00'01 ] == 1 );
+static_assert( generate_quadrature_transition_table()[ 0b01'11 ] == 1 );
+static_assert( generate_quadrature_transition_table()[ 0b11'10 ] == 1 );
+static_assert( generate_quadrature_transition_table()[ 0b10'00 ] == 1 );
+static_assert( generate_quadrature_transition_table()[ 0b01'00 ] == -1 );
+static_assert( generate_quadrature_transition_table()[ 0b11'01 ] == -1 );
+static_assert( generate_quadrature_transition_table()[ 0b10'11 ] == -1 );
+static_assert( generate_quadrature_transition_table()[ 0b00'10 ] == -1 );
+static_assert( generate_quadrature_transition_table()[ 0b00'00 ] == 0 );
+static_assert( generate_quadrature_transition_table()[ 0b11'11 ] == 0 );
+static_assert( generate_quadrature_transition_table()[ 0b00'11 ] == 0 );
+static_assert( generate_quadrature_transition_table()[ 0b01'10 ] == 0 );
+
+/**
+ * \brief Quadrature decoder.
+ *
+ * \tparam VPORT_Instance The GPIO virtual port instance the encoder's A and B pins are
+ *         members of (e.g. picolibrary::Microchip::megaAVR0::Peripheral::VPORTA).
+ * \tparam A_BIT The bit position of the encoder's A pin.
+ * \tparam B_BIT The bit position of the encoder's B pin.
+ *
+ * The decoder counts every edge of the encoder's A and B signals (4 counts per encoder
+ * cycle). picolibrary::Microchip::megaAVR0::Encoder::Quadrature_Decoder::update() must be
+ * called on every edge of the A and B pins, typically by binding it to both pins using a
+ * picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Interrupt_Dispatcher configured for
+ * both edges.
+ *
+ * \attention The megaAVR 0-series TCA and TCB peripherals cannot count events with a
+ *            direction supplied by a second event, so decoding is performed in the GPIO
+ *            port's interrupt handler instead of being routed through EVSYS, CCL, and a
+ *            timer/counter.
+ */
+template<typename VPORT_Instance, std::uint_fast8_t A_BIT, std::uint_fast8_t B_BIT>
+class Quadrature_Decoder {
+  public:
+    static_assert( A_BIT < 8 );
+    static_assert( B_BIT < 8 );
+    static_assert( A_BIT != B_BIT );
+
+    Quadrature_Decoder() = delete;
+
+    /**
+     * \brief Initialize the decoder's state.
+     *
+     * \param[in] position The initial position.
+     */
+    static void initialize( std::int16_t position = 0 ) noexcept
+    {
+        Interrupt::Controller interrupt_controller;
+
+        auto const interrupt_enable_state =
+            interrupt_controller.save_interrupt_enable_state();
+
+        interrupt_controller.disable_interrupt();
+
+        m_state    = state();
+        m_position = position;
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+    }
+
+    /**
+     * \brief Update the position.
+     *
+     * \attention This function must be called on every edge of the A and B pins, and
+     *            must not be interrupted by a call to initialize() (call it from the GPIO
+     *            port's interrupt handler).
+     */
+    static void update() noexcept
+    {
+        auto const current_state = state();
+
+        m_position = m_position + TRANSITION_TABLE[ ( m_state << 2 ) | current_state ];
+        m_state    = current_state;
+    }
+
+    /**
+     * \brief Get the position.
+     *
+     * \return The position.
+     */
+    static auto position() noexcept -> std::int16_t
+    {
+        Interrupt::Controller interrupt_controller;
+
+        auto const interrupt_enable_state =
+            interrupt_controller.save_interrupt_enable_state();
+
+        interrupt_controller.disable_interrupt();
+
+        std::int16_t const position = m_position;
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+
+        return position;
+    }
+
+  private:
+    /**
+     * \brief The quadrature state transition table.
+     */
+    static constexpr auto TRANSITION_TABLE = generate_quadrature_transition_table();
+
+    /**
+     * \brief The previous quadrature state.
+     */
+    static inline std::uint_fast8_t m_state{};
+
+    /**
+     * \brief The position.
+     */
+    static inline std::int16_t volatile m_position{};
+
+    /**
+     * \brief Get the current quadrature state.
+     *
+     * \return The current quadrature state.
+     */
+    static auto state() noexcept -> std::uint_fast8_t
+    {
+        std::uint8_t const in = VPORT_Instance::instance().in;
+
+        return ( ( in >> A_BIT & 0x1 ) << 1 ) | ( in >> B_BIT & 0x1 );
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::Encoder
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_ENCODER_H
@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "picolibrary/gpio.h"
+#include "picolibrary/peripheral.h"
 #include "picolibrary/microchip/megaavr0/peripheral/port.h"
 #include "picolibrary/microchip/megaavr0/peripheral/vport.h"
 
@@ -1020,6 +1021,1055 @@ class Push_Pull_IO_Pin {
     }
 };
 
+/**
+ * \brief Push-pull I/O pin group.
+ *
+ * \tparam Peripheral The type of peripheral used to implement pin group functionality
+ *         (must be picolibrary::Microchip::megaAVR0::Peripheral::PORT or
+ *         picolibrary::Microchip::megaAVR0::Peripheral::VPORT).
+ *
+ * A pin group drives any number of pins in the same GPIO port or virtual port with a
+ * single register access, making it suitable for parallel buses and sets of chip selects.
+ */
+template<typename Peripheral>
+class Pin_Group;
+
+/**
+ * \brief picolibrary::Microchip::megaAVR0::Peripheral::PORT based pin group.
+ */
+template<>
+class Pin_Group<Peripheral::PORT> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Pin_Group() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] port The GPIO port the pins are members of.
+     * \param[in] mask The mask identifying the pins.
+     */
+    constexpr Pin_Group( Peripheral::PORT & port, std::uint8_t mask ) noexcept :
+        m_port{ &port },
+        m_mask{ mask }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Pin_Group( Pin_Group && source ) noexcept :
+        m_port{ source.m_port },
+        m_mask{ source.m_mask }
+    {
+        source.m_port = nullptr;
+        source.m_mask = 0;
+    }
+
+    Pin_Group( Pin_Group const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Pin_Group() noexcept
+    {
+        disable();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Pin_Group && expression ) noexcept -> Pin_Group &
+    {
+        if ( &expression != this ) {
+            disable();
+
+            m_port = expression.m_port;
+            m_mask = expression.m_mask;
+
+            expression.m_port = nullptr;
+            expression.m_mask = 0;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Pin_Group const & ) = delete;
+
+    /**
+     * \brief Get the mask identifying the pins.
+     *
+     * \return The mask identifying the pins.
+     */
+    constexpr auto mask() const noexcept -> std::uint8_t
+    {
+        return m_mask;
+    }
+
+    /**
+     * \brief Initialize the pin group's hardware.
+     *
+     * \param[in] initial_value The initial state of the pins (bits outside of the pin
+     *            group's mask are ignored).
+     */
+    void initialize( std::uint8_t initial_value = 0 ) noexcept
+    {
+        write( initial_value );
+
+        m_port->dirset = m_mask;
+    }
+
+    /**
+     * \brief Read the state of the pins.
+     *
+     * \return The state of the pins (bits outside of the pin group's mask are cleared).
+     */
+    auto read() const noexcept -> std::uint8_t
+    {
+        return m_port->in & m_mask;
+    }
+
+    /**
+     * \brief Write the state of the pins.
+     *
+     * \param[in] value The state to write to the pins (bits outside of the pin group's
+     *            mask are ignored).
+     *
+     * \attention Only the pins whose state changes are modified, using a single OUTTGL
+     *            register write.
+     */
+    void write( std::uint8_t value ) noexcept
+    {
+        m_port->outtgl = ( m_port->out ^ value ) & m_mask;
+    }
+
+    /**
+     * \brief Transition all of the pins to the low state.
+     */
+    void transition_to_low() noexcept
+    {
+        transition_to_low( m_mask );
+    }
+
+    /**
+     * \brief Transition a subset of the pins to the low state.
+     *
+     * \param[in] mask The mask identifying the pins to transition to the low state (bits
+     *            outside of the pin group's mask are ignored).
+     */
+    void transition_to_low( std::uint8_t mask ) noexcept
+    {
+        m_port->outclr = mask & m_mask;
+    }
+
+    /**
+     * \brief Transition all of the pins to the high state.
+     */
+    void transition_to_high() noexcept
+    {
+        transition_to_high( m_mask );
+    }
+
+    /**
+     * \brief Transition a subset of the pins to the high state.
+     *
+     * \param[in] mask The mask identifying the pins to transition to the high state (bits
+     *            outside of the pin group's mask are ignored).
+     */
+    void transition_to_high( std::uint8_t mask ) noexcept
+    {
+        m_port->outset = mask & m_mask;
+    }
+
+    /**
+     * \brief Toggle the state of all of the pins.
+     */
+    void toggle() noexcept
+    {
+        toggle( m_mask );
+    }
+
+    /**
+     * \brief Toggle the state of a subset of the pins.
+     *
+     * \param[in] mask The mask identifying the pins to toggle (bits outside of the pin
+     *            group's mask are ignored).
+     */
+    void toggle( std::uint8_t mask ) noexcept
+    {
+        m_port->outtgl = mask & m_mask;
+    }
+
+  private:
+    /**
+     * \brief The GPIO port the pins are members of.
+     */
+    Peripheral::PORT * m_port{};
+
+    /**
+     * \brief The mask identifying the pins.
+     */
+    std::uint8_t m_mask{};
+
+    /**
+     * \brief Disable the pin group.
+     */
+    constexpr void disable() noexcept
+    {
+        if ( m_port ) {
+            m_port->dirclr = m_mask;
+        } // if
+    }
+};
+
+/**
+ * \brief picolibrary::Microchip::megaAVR0::Peripheral::VPORT based pin group.
+ */
+template<>
+class Pin_Group<Peripheral::VPORT> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Pin_Group() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] vport The GPIO virtual port the pins are members of.
+     * \param[in] mask The mask identifying the pins.
+     */
+    constexpr Pin_Group( Peripheral::VPORT & vport, std::uint8_t mask ) noexcept :
+        m_vport{ &vport },
+        m_mask{ mask }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Pin_Group( Pin_Group && source ) noexcept :
+        m_vport{ source.m_vport },
+        m_mask{ source.m_mask }
+    {
+        source.m_vport = nullptr;
+        source.m_mask  = 0;
+    }
+
+    Pin_Group( Pin_Group const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Pin_Group() noexcept
+    {
+        disable();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Pin_Group && expression ) noexcept -> Pin_Group &
+    {
+        if ( &expression != this ) {
+            disable();
+
+            m_vport = expression.m_vport;
+            m_mask  = expression.m_mask;
+
+            expression.m_vport = nullptr;
+            expression.m_mask  = 0;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Pin_Group const & ) = delete;
+
+    /**
+     * \brief Get the mask identifying the pins.
+     *
+     * \return The mask identifying the pins.
+     */
+    constexpr auto mask() const noexcept -> std::uint8_t
+    {
+        return m_mask;
+    }
+
+    /**
+     * \brief Initialize the pin group's hardware.
+     *
+     * \param[in] initial_value The initial state of the pins (bits outside of the pin
+     *            group's mask are ignored).
+     */
+    void initialize( std::uint8_t initial_value = 0 ) noexcept
+    {
+        write( initial_value );
+
+        m_vport->dir |= m_mask;
+    }
+
+    /**
+     * \brief Read the state of the pins.
+     *
+     * \return The state of the pins (bits outside of the pin group's mask are cleared).
+     */
+    auto read() const noexcept -> std::uint8_t
+    {
+        return m_vport->in & m_mask;
+    }
+
+    /**
+     * \brief Write the state of the pins.
+     *
+     * \param[in] value The state to write to the pins (bits outside of the pin group's
+     *            mask are ignored).
+     *
+     * \attention Only the pins whose state changes are modified, using a single IN
+     *            register write (writing a 1 to a bit in the IN register toggles the
+     *            corresponding bit in the OUT register).
+     */
+    void write( std::uint8_t value ) noexcept
+    {
+        m_vport->in = ( m_vport->out ^ value ) & m_mask;
+    }
+
+    /**
+     * \brief Transition all of the pins to the low state.
+     */
+    void transition_to_low() noexcept
+    {
+        transition_to_low( m_mask );
+    }
+
+    /**
+     * \brief Transition a subset of the pins to the low state.
+     *
+     * \param[in] mask The mask identifying the pins to transition to the low state (bits
+     *            outside of the pin group's mask are ignored).
+     */
+    void transition_to_low( std::uint8_t mask ) noexcept
+    {
+        m_vport->in = m_vport->out & mask & m_mask;
+    }
+
+    /**
+     * \brief Transition all of the pins to the high state.
+     */
+    void transition_to_high() noexcept
+    {
+        transition_to_high( m_mask );
+    }
+
+    /**
+     * \brief Transition a subset of the pins to the high state.
+     *
+     * \param[in] mask The mask identifying the pins to transition to the high state (bits
+     *            outside of the pin group's mask are ignored).
+     */
+    void transition_to_high( std::uint8_t mask ) noexcept
+    {
+        m_vport->in = ~m_vport->out & mask & m_mask;
+    }
+
+    /**
+     * \brief Toggle the state of all of the pins.
+     */
+    void toggle() noexcept
+    {
+        toggle( m_mask );
+    }
+
+    /**
+     * \brief Toggle the state of a subset of the pins.
+     *
+     * \param[in] mask The mask identifying the pins to toggle (bits outside of the pin
+     *            group's mask are ignored).
+     */
+    void toggle( std::uint8_t mask ) noexcept
+    {
+        m_vport->in = mask & m_mask;
+    }
+
+  private:
+    /**
+     * \brief The GPIO virtual port the pins are members of.
+     */
+    Peripheral::VPORT * m_vport{};
+
+    /**
+     * \brief The mask identifying the pins.
+     */
+    std::uint8_t m_mask{};
+
+    /**
+     * \brief Disable the pin group.
+     */
+    constexpr void disable() noexcept
+    {
+        if ( m_vport ) {
+            m_vport->dir &= ~m_mask;
+        } // if
+    }
+};
+
+/**
+ * \brief picolibrary::Microchip::megaAVR0::GPIO::Pin_Group deduction guide.
+ */
+template<typename Peripheral>
+Pin_Group( Peripheral &, std::uint8_t ) -> Pin_Group<Peripheral>;
+
+/**
+ * \brief Compile-time picolibrary::Microchip::megaAVR0::Peripheral::VPORT based pin.
+ *
+ * \tparam VPORT_Instance The GPIO virtual port instance the pin is a member of (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::VPORTA).
+ * \tparam BIT The bit position of the pin.
+ *
+ * All pin state transitions and direction changes are implemented using a single SBI or
+ * CBI instruction. Open-drain I/O pin toggling uses the PORT peripheral's DIRTGL register
+ * since the VPORT DIR register does not support toggling.
+ */
+template<typename VPORT_Instance, std::uint_fast8_t BIT>
+class Static_Pin {
+  public:
+    static_assert( BIT < 8 );
+    static_assert( VPORT_Instance::ADDRESS + 2 <= 0x1F );
+
+    /**
+     * \brief The mask identifying the pin.
+     */
+    static constexpr auto MASK = static_cast<std::uint8_t>( 1 << BIT );
+
+    Static_Pin() = delete;
+
+    /**
+     * \brief Configure the pin to act as an input.
+     */
+    static void configure_pin_as_input() noexcept
+    {
+        clear_bit<DIR_ADDRESS>();
+    }
+
+    /**
+     * \brief Configure the pin to act as an open-drain I/O pin.
+     */
+    static void configure_pin_as_open_drain_io() noexcept
+    {
+        clear_bit<OUT_ADDRESS>();
+    }
+
+    /**
+     * \brief Configure the pin to act as a push-pull I/O pin.
+     */
+    static void configure_pin_as_push_pull_io() noexcept
+    {
+        set_bit<DIR_ADDRESS>();
+    }
+
+    /**
+     * \brief Check if the pin is in the low state.
+     *
+     * \return true if the pin is in the low state.
+     * \return false if the pin is not in the low state.
+     */
+    static auto is_low() noexcept -> bool
+    {
+        return not is_high();
+    }
+
+    /**
+     * \brief Check if the pin is in the high state.
+     *
+     * \return true if the pin is in the high state.
+     * \return false if the pin is not in the high state.
+     */
+    static auto is_high() noexcept -> bool
+    {
+        return VPORT_Instance::instance().in & MASK;
+    }
+
+    /**
+     * \brief Transition an open-drain I/O pin to the low state.
+     */
+    static void transition_open_drain_io_to_low() noexcept
+    {
+        set_bit<DIR_ADDRESS>();
+    }
+
+    /**
+     * \brief Transition a push-pull I/O pin to the low state.
+     */
+    static void transition_push_pull_io_to_low() noexcept
+    {
+        clear_bit<OUT_ADDRESS>();
+    }
+
+    /**
+     * \brief Transition an open-drain I/O pin to the high state.
+     */
+    static void transition_open_drain_io_to_high() noexcept
+    {
+        clear_bit<DIR_ADDRESS>();
+    }
+
+    /**
+     * \brief Transition a push-pull I/O pin to the high state.
+     */
+    static void transition_push_pull_io_to_high() noexcept
+    {
+        set_bit<OUT_ADDRESS>();
+    }
+
+    /**
+     * \brief Toggle the state of an open-drain I/O pin.
+     */
+    static void toggle_open_drain_io() noexcept
+    {
+        PORT_Instance::instance().dirtgl = MASK;
+    }
+
+    /**
+     * \brief Toggle the state of a push-pull I/O pin.
+     */
+    static void toggle_push_pull_io() noexcept
+    {
+        // writing a 1 to a bit in the IN register toggles the corresponding OUT bit
+        set_bit<IN_ADDRESS>();
+    }
+
+  private:
+    /**
+     * \brief The I/O address of the VPORT DIR register.
+     */
+    static constexpr auto DIR_ADDRESS = std::uintptr_t{ VPORT_Instance::ADDRESS + 0 };
+
+    /**
+     * \brief The I/O address of the VPORT OUT register.
+     */
+    static constexpr auto OUT_ADDRESS = std::uintptr_t{ VPORT_Instance::ADDRESS + 1 };
+
+    /**
+     * \brief The I/O address of the VPORT IN register.
+     */
+    static constexpr auto IN_ADDRESS = std::uintptr_t{ VPORT_Instance::ADDRESS + 2 };
+
+    /**
+     * \brief The GPIO port instance associated with the GPIO virtual port.
+     */
+    using PORT_Instance = ::picolibrary::Peripheral::
+        Instance<Peripheral::PORT, 0x0400 + VPORT_Instance::ADDRESS / 4 * 0x20>;
+
+    /**
+     * \brief Set the pin's bit in a VPORT register.
+     *
+     * \tparam ADDRESS The I/O address of the VPORT register.
+     */
+    template<std::uintptr_t ADDRESS>
+    static void set_bit() noexcept
+    {
+        asm volatile( "sbi %[address], %[bit]"
+                      :
+                      : [ address ] "I"( ADDRESS ), [ bit ] "I"( BIT )
+                      : "memory" );
+    }
+
+    /**
+     * \brief Clear the pin's bit in a VPORT register.
+     *
+     * \tparam ADDRESS The I/O address of the VPORT register.
+     */
+    template<std::uintptr_t ADDRESS>
+    static void clear_bit() noexcept
+    {
+        asm volatile( "cbi %[address], %[bit]"
+                      :
+                      : [ address ] "I"( ADDRESS ), [ bit ] "I"( BIT )
+                      : "memory" );
+    }
+};
+
+/**
+ * \brief Compile-time input pin.
+ *
+ * \tparam VPORT_Instance The GPIO virtual port instance the pin is a member of (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::VPORTA).
+ * \tparam BIT The bit position of the pin.
+ *
+ * The pin is identified entirely by its template arguments so objects of this type do not
+ * require any RAM. Since pin ownership is not tracked, the pin is not disabled when an
+ * object of this type is destroyed.
+ */
+template<typename VPORT_Instance, std::uint_fast8_t BIT>
+class Static_Input_Pin {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Static_Input_Pin() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Static_Input_Pin( Static_Input_Pin && source ) noexcept = default;
+
+    Static_Input_Pin( Static_Input_Pin const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Input_Pin() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_Input_Pin && expression ) noexcept -> Static_Input_Pin & = default;
+
+    auto operator=( Static_Input_Pin const & ) = delete;
+
+    /**
+     * \brief Initialize the pin's hardware.
+     */
+    static void initialize() noexcept
+    {
+        Pin::configure_pin_as_input();
+    }
+
+    /**
+     * \brief Check if the pin is in the low state.
+     *
+     * \return true if the pin is in the low state.
+     * \return false if the pin is not in the low state.
+     */
+    static auto is_low() noexcept -> bool
+    {
+        return Pin::is_low();
+    }
+
+    /**
+     * \brief Check if the pin is in the high state.
+     *
+     * \return true if the pin is in the high state.
+     * \return false if the pin is not in the high state.
+     */
+    static auto is_high() noexcept -> bool
+    {
+        return Pin::is_high();
+    }
+
+  private:
+    /**
+     * \brief The pin.
+     */
+    using Pin = Static_Pin<VPORT_Instance, BIT>;
+};
+
+/**
+ * \brief Compile-time open-drain I/O pin.
+ *
+ * \tparam VPORT_Instance The GPIO virtual port instance the pin is a member of (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::VPORTA).
+ * \tparam BIT The bit position of the pin.
+ *
+ * The pin is identified entirely by its template arguments so objects of this type do not
+ * require any RAM. Since pin ownership is not tracked, the pin is not disabled when an
+ * object of this type is destroyed.
+ */
+template<typename VPORT_Instance, std::uint_fast8_t BIT>
+class Static_Open_Drain_IO_Pin {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Static_Open_Drain_IO_Pin() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Static_Open_Drain_IO_Pin( Static_Open_Drain_IO_Pin && source ) noexcept = default;
+
+    Static_Open_Drain_IO_Pin( Static_Open_Drain_IO_Pin const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Open_Drain_IO_Pin() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_Open_Drain_IO_Pin && expression ) noexcept -> Static_Open_Drain_IO_Pin & = default;
+
+    auto operator=( Static_Open_Drain_IO_Pin const & ) = delete;
+
+    /**
+     * \brief Initialize the pin's hardware.
+     *
+     * \param[in] initial_pin_state The initial state of the pin.
+     */
+    static void initialize( ::picolibrary::GPIO::Initial_Pin_State initial_pin_state = ::picolibrary::GPIO::Initial_Pin_State::LOW ) noexcept
+    {
+        Pin::configure_pin_as_open_drain_io();
+
+        switch ( initial_pin_state ) {
+            case ::picolibrary::GPIO::Initial_Pin_State::LOW:
+                Pin::transition_open_drain_io_to_low();
+                break;
+            case ::picolibrary::GPIO::Initial_Pin_State::HIGH:
+                Pin::transition_open_drain_io_to_high();
+                break;
+        } // switch
+    }
+
+    /**
+     * \brief Check if the pin is in the low state.
+     *
+     * \return true if the pin is in the low state.
+     * \return false if the pin is not in the low state.
+     */
+    static auto is_low() noexcept -> bool
+    {
+        return Pin::is_low();
+    }
+
+    /**
+     * \brief Check if the pin is in the high state.
+     *
+     * \return true if the pin is in the high state.
+     * \return false if the pin is not in the high state.
+     */
+    static auto is_high() noexcept -> bool
+    {
+        return Pin::is_high();
+    }
+
+    /**
+     * \brief Transition the pin to the low state.
+     */
+    static void transition_to_low() noexcept
+    {
+        Pin::transition_open_drain_io_to_low();
+    }
+
+    /**
+     * \brief Transition the pin to the high state.
+     */
+    static void transition_to_high() noexcept
+    {
+        Pin::transition_open_drain_io_to_high();
+    }
+
+    /**
+     * \brief Toggle the pin state.
+     */
+    static void toggle() noexcept
+    {
+        Pin::toggle_open_drain_io();
+    }
+
+  private:
+    /**
+     * \brief The pin.
+     */
+    using Pin = Static_Pin<VPORT_Instance, BIT>;
+};
+
+/**
+ * \brief Compile-time push-pull I/O pin.
+ *
+ * \tparam VPORT_Instance The GPIO virtual port instance the pin is a member of (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::VPORTA).
+ * \tparam BIT The bit position of the pin.
+ *
+ * The pin is identified entirely by its template arguments so objects of this type do not
+ * require any RAM. Since pin ownership is not tracked, the pin is not disabled when an
+ * object of this type is destroyed.
+ */
+template<typename VPORT_Instance, std::uint_fast8_t BIT>
+class Static_Push_Pull_IO_Pin {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Static_Push_Pull_IO_Pin() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Static_Push_Pull_IO_Pin( Static_Push_Pull_IO_Pin && source ) noexcept = default;
+
+    Static_Push_Pull_IO_Pin( Static_Push_Pull_IO_Pin const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Push_Pull_IO_Pin() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_Push_Pull_IO_Pin && expression ) noexcept -> Static_Push_Pull_IO_Pin & = default;
+
+    auto operator=( Static_Push_Pull_IO_Pin const & ) = delete;
+
+    /**
+     * \brief Initialize the pin's hardware.
+     *
+     * \param[in] initial_pin_state The initial state of the pin.
+     */
+    static void initialize( ::picolibrary::GPIO::Initial_Pin_State initial_pin_state = ::picolibrary::GPIO::Initial_Pin_State::LOW ) noexcept
+    {
+        switch ( initial_pin_state ) {
+            case ::picolibrary::GPIO::Initial_Pin_State::LOW:
+                Pin::transition_push_pull_io_to_low();
+                break;
+            case ::picolibrary::GPIO::Initial_Pin_State::HIGH:
+                Pin::transition_push_pull_io_to_high();
+                break;
+        } // switch
+
+        Pin::configure_pin_as_push_pull_io();
+    }
+
+    /**
+     * \brief Check if the pin is in the low state.
+     *
+     * \return true if the pin is in the low state.
+     * \return false if the pin is not in the low state.
+     */
+    static auto is_low() noexcept -> bool
+    {
+        return Pin::is_low();
+    }
+
+    /**
+     * \brief Check if the pin is in the high state.
+     *
+     * \return true if the pin is in the high state.
+     * \return false if the pin is not in the high state.
+     */
+    static auto is_high() noexcept -> bool
+    {
+        return Pin::is_high();
+    }
+
+    /**
+     * \brief Transition the pin to the low state.
+     */
+    static void transition_to_low() noexcept
+    {
+        Pin::transition_push_pull_io_to_low();
+    }
+
+    /**
+     * \brief Transition the pin to the high state.
+     */
+    static void transition_to_high() noexcept
+    {
+        Pin::transition_push_pull_io_to_high();
+    }
+
+    /**
+     * \brief Toggle the pin state.
+     */
+    static void toggle() noexcept
+    {
+        Pin::toggle_push_pull_io();
+    }
+
+  private:
+    /**
+     * \brief The pin.
+     */
+    using Pin = Static_Pin<VPORT_Instance, BIT>;
+};
+
+/**
+ * \brief Pin change interrupt sense configuration.
+ */
+enum class Pin_Change_Sense : std::uint8_t {
+    BOTH_EDGES   = Peripheral::PORT::PINCTRL::ISC_BOTHEDGES, ///< Both edges.
+    RISING_EDGE  = Peripheral::PORT::PINCTRL::ISC_RISING,    ///< Rising edge.
+    FALLING_EDGE = Peripheral::PORT::PINCTRL::ISC_FALLING,   ///< Falling edge.
+    LOW_LEVEL    = Peripheral::PORT::PINCTRL::ISC_LEVEL,     ///< Low level.
+};
+
+/**
+ * \brief Pin change handler.
+ *
+ * \tparam BIT The bit position of the pin whose changes are handled.
+ * \tparam SENSE The pin change interrupt sense configuration.
+ * \tparam HANDLER The function to call when the pin changes (must be callable with no
+ *         arguments).
+ */
+template<std::uint_fast8_t BIT, Pin_Change_Sense SENSE, auto HANDLER>
+class Pin_Change_Handler {
+  public:
+    static_assert( BIT < 8 );
+
+    /**
+     * \brief The bit position of the pin whose changes are handled.
+     */
+    static constexpr auto PIN_BIT_POSITION = BIT;
+
+    /**
+     * \brief The mask identifying the pin whose changes are handled.
+     */
+    static constexpr auto MASK = static_cast<std::uint8_t>( 1 << BIT );
+
+    /**
+     * \brief The pin change interrupt sense configuration.
+     */
+    static constexpr auto PIN_CHANGE_SENSE = SENSE;
+
+    Pin_Change_Handler() = delete;
+
+    /**
+     * \brief Handle a pin change.
+     */
+    static void handle() noexcept
+    {
+        HANDLER();
+    }
+};
+
+/**
+ * \brief Pin change interrupt dispatcher.
+ *
+ * \tparam PORT_Instance The GPIO port instance whose pin change interrupt is dispatched
+ *         (e.g. picolibrary::Microchip::megaAVR0::Peripheral::PORTA).
+ * \tparam Handlers The port's pin change handlers (must be
+ *         picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Handler instantiations with
+ *         unique pins).
+ *
+ * The dispatcher's handle_interrupt() static member function must be called from the
+ * GPIO port's interrupt handler (e.g. PORTA_PORT_vect).
+ */
+template<typename PORT_Instance, typename... Handlers>
+class Pin_Change_Interrupt_Dispatcher {
+  public:
+    static_assert( sizeof...( Handlers ) > 0 );
+
+    /**
+     * \brief The mask identifying the pins that have handlers.
+     */
+    static constexpr auto MASK = static_cast<std::uint8_t>( ( Handlers::MASK | ... ) );
+
+    static_assert( ( Handlers::MASK + ... + 0 ) == MASK, "handler pins must be unique" );
+
+    Pin_Change_Interrupt_Dispatcher() = delete;
+
+    /**
+     * \brief Configure each handled pin's pin change interrupt sense and enable the pin
+     *        change interrupts.
+     */
+    static void initialize() noexcept
+    {
+        auto & port = PORT_Instance::instance();
+
+        ( configure_pin<Handlers>(
+              port, static_cast<std::uint8_t>( Handlers::PIN_CHANGE_SENSE ) ),
+          ... );
+
+        port.intflags = MASK;
+    }
+
+    /**
+     * \brief Disable the handled pins' pin change interrupts.
+     */
+    static void disable() noexcept
+    {
+        auto & port = PORT_Instance::instance();
+
+        ( configure_pin<Handlers>( port, Peripheral::PORT::PINCTRL::ISC_INTDISABLE ),
+          ... );
+
+        port.intflags = MASK;
+    }
+
+    /**
+     * \brief Handle a GPIO port interrupt.
+     *
+     * All of the port's interrupt flags are cleared before any handlers are called so
+     * that pin changes that occur while the handlers are executing are not lost. The
+     * handlers are called in template argument order.
+     */
+    static void handle_interrupt() noexcept
+    {
+        auto & port = PORT_Instance::instance();
+
+        std::uint8_t const flags = port.intflags;
+
+        port.intflags = flags;
+
+        ( dispatch<Handlers>( flags ), ... );
+    }
+
+  private:
+    /**
+     * \brief Configure a handled pin's pin change interrupt sense.
+     *
+     * \tparam Handler The pin's handler.
+     *
+     * \param[in] port The GPIO port the pin is a member of.
+     * \param[in] isc The pin's ISC field value.
+     */
+    template<typename Handler>
+    static void configure_pin( Peripheral::PORT & port, std::uint8_t isc ) noexcept
+    {
+        auto & pinctrl = port.pinctrl[ Handler::PIN_BIT_POSITION ];
+
+        pinctrl = ( pinctrl & ~Peripheral::PORT::PINCTRL::Mask::ISC ) | isc;
+    }
+
+    /**
+     * \brief Call a handler if its pin has changed.
+     *
+     * \tparam Handler The handler.
+     *
+     * \param[in] flags The GPIO port's interrupt flags.
+     */
+    template<typename Handler>
+    static void dispatch( std::uint8_t flags ) noexcept
+    {
+        if ( flags & Handler::MASK ) {
+            Handler::handle();
+        } // if
+    }
+};
+
 } // namespace picolibrary::Microchip::megaAVR0::GPIO
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_GPIO_H
@@ -27,9 +27,11 @@
 
 #include "picolibrary/error.h"
 #include "picolibrary/i2c.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
 #include "picolibrary/microchip/megaavr0/multiplexed_signals.h"
 #include "picolibrary/microchip/megaavr0/peripheral/twi.h"
 #include "picolibrary/postcondition.h"
+#include "picolibrary/precondition.h"
 #include "picolibrary/utility.h"
 
 /**
@@ -66,6 +68,76 @@ enum class TWI_Inactive_Bus_Time_Out : std::uint8_t {
     _200_US  = Peripheral::TWI::MCTRLA::TIMEOUT_200US, ///< 200 us (assumes clock frequency is set to 100 kHz).
 };
 
+/**
+ * \brief Enable a TWI peripheral's dual mode (device operation on a separate pair of
+ *        pins).
+ *
+ * \attention The TWI peripheral's routing configuration determines which pins are used
+ *            for device operation while dual mode is enabled (see
+ *            picolibrary::Microchip::megaAVR0::Multiplexed_Signals::TWI_Route).
+ *
+ * \param[in] twi The TWI peripheral whose dual mode is to be enabled.
+ * \param[in] twi_sda_hold_time The desired device pins TWI SDA hold time.
+ * \param[in] twi_bus_speed The desired device pins TWI bus speed configuration.
+ */
+inline void enable_dual_mode(
+    Peripheral::TWI & twi,
+    TWI_SDA_Hold_Time twi_sda_hold_time,
+    TWI_Bus_Speed     twi_bus_speed ) noexcept
+{
+    static_assert(
+        Peripheral::TWI::DUALCTRL::Mask::SDAHOLD
+        == Peripheral::TWI::CTRLA::Mask::SDAHOLD );
+    static_assert(
+        Peripheral::TWI::DUALCTRL::Mask::FMPEN == Peripheral::TWI::CTRLA::Mask::FMPEN );
+
+    twi.dualctrl = to_underlying( twi_sda_hold_time ) | to_underlying( twi_bus_speed )
+                   | Peripheral::TWI::DUALCTRL::Mask::ENABLE;
+}
+
+/**
+ * \brief Enable a TWI peripheral's dual mode (device operation on a separate pair of
+ *        pins).
+ *
+ * \param[in] twi The TWI peripheral whose dual mode is to be enabled.
+ * \param[in] twi_sda_hold_time The desired device pins TWI SDA hold time.
+ * \param[in] twi_bus_speed The desired device pins TWI bus speed configuration.
+ * \param[in] twi_route The desired TWI peripheral routing configuration.
+ */
+inline void enable_dual_mode(
+    Peripheral::TWI &              twi,
+    TWI_SDA_Hold_Time              twi_sda_hold_time,
+    TWI_Bus_Speed                  twi_bus_speed,
+    Multiplexed_Signals::TWI_Route twi_route ) noexcept
+{
+    Multiplexed_Signals::set_twi_route( twi, twi_route );
+
+    enable_dual_mode( twi, twi_sda_hold_time, twi_bus_speed );
+}
+
+/**
+ * \brief Disable a TWI peripheral's dual mode.
+ *
+ * \param[in] twi The TWI peripheral whose dual mode is to be disabled.
+ */
+inline void disable_dual_mode( Peripheral::TWI & twi ) noexcept
+{
+    twi.dualctrl = 0;
+}
+
+/**
+ * \brief Check if a TWI peripheral's dual mode is enabled.
+ *
+ * \param[in] twi The TWI peripheral to check.
+ *
+ * \return true if the TWI peripheral's dual mode is enabled.
+ * \return false if the TWI peripheral's dual mode is not enabled.
+ */
+inline auto dual_mode_enabled( Peripheral::TWI const & twi ) noexcept -> bool
+{
+    return twi.dualctrl & Peripheral::TWI::DUALCTRL::Mask::ENABLE;
+}
+
 /**
  * \brief Basic controller.
  */
@@ -129,6 +201,35 @@ class Basic_Controller {
             twi_sda_hold_time, twi_bus_speed, twi_clock_generator_scaling_factor, twi_inactive_bus_time_out );
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \tparam TWI_Instance The TWI peripheral instance to be used by the controller.
+     * \tparam TWI_ROUTE The desired TWI peripheral routing configuration.
+     *
+     * \param[in] twi_sda_hold_time The desired TWI SDA hold time.
+     * \param[in] twi_bus_speed The desired TWI bus speed.
+     * \param[in] twi_clock_generator_scaling_factor The desired TWI clock generator
+     *            scaling factor (MBAUD register value).
+     * \param[in] twi_inactive_bus_time_out The desired TWI inactive bus time-out.
+     */
+    template<typename TWI_Instance, Multiplexed_Signals::TWI_Route TWI_ROUTE>
+    Basic_Controller(
+        Multiplexed_Signals::TWI_Signals<TWI_Instance, TWI_ROUTE>,
+        TWI_SDA_Hold_Time         twi_sda_hold_time,
+        TWI_Bus_Speed             twi_bus_speed,
+        std::uint8_t              twi_clock_generator_scaling_factor,
+        TWI_Inactive_Bus_Time_Out twi_inactive_bus_time_out ) noexcept :
+        m_twi{ &TWI_Instance::instance() }
+    {
+        // #lizard forgives the parameter count
+
+        Multiplexed_Signals::TWI_Signals<TWI_Instance, TWI_ROUTE>::set_route();
+
+        configure_controller(
+            twi_sda_hold_time, twi_bus_speed, twi_clock_generator_scaling_factor, twi_inactive_bus_time_out );
+    }
+
     /**
      * \brief Constructor.
      *
@@ -468,6 +569,899 @@ class Basic_Controller {
  */
 using Controller = ::picolibrary::I2C::Controller<Basic_Controller>;
 
+/**
+ * \brief Transaction state.
+ */
+enum class Transaction_State : std::uint8_t {
+    IDLE,             ///< The transaction has not been queued.
+    QUEUED,           ///< The transaction is waiting to be executed.
+    IN_PROGRESS,      ///< The transaction is being executed.
+    COMPLETE,         ///< The transaction was completed successfully.
+    NACK,             ///< The device responded with a NACK.
+    BUS_ERROR,        ///< A bus error was detected.
+    ARBITRATION_LOST, ///< Arbitration was lost.
+};
+
+/**
+ * \brief Transaction.
+ *
+ * A transaction consists of addressing a device followed by reading or writing a block of
+ * data. The transaction and its data block are owned by the caller, and must remain valid
+ * until the transaction is no longer queued or in progress.
+ */
+class Transaction {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Transaction() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] address The address of the device to address.
+     * \param[in] operation The operation to perform once the device has been addressed.
+     * \param[in] begin The beginning of the block of data to read into (read operation)
+     *            or write (write operation).
+     * \param[in] end The end of the block of data to read into (read operation) or write
+     *            (write operation).
+     */
+    constexpr Transaction(
+        ::picolibrary::I2C::Address_Transmitted address,
+        ::picolibrary::I2C::Operation           operation,
+        std::uint8_t *                          begin,
+        std::uint8_t *                          end ) noexcept :
+        m_address{ static_cast<std::uint8_t>(
+            address.as_unsigned_integer() | to_underlying( operation ) ) },
+        m_begin{ begin },
+        m_end{ end }
+    {
+    }
+
+    Transaction( Transaction && ) = delete;
+
+    Transaction( Transaction const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Transaction() noexcept = default;
+
+    auto operator=( Transaction && ) = delete;
+
+    auto operator=( Transaction const & ) = delete;
+
+    /**
+     * \brief Get the address of the device to address.
+     *
+     * \return The address of the device to address.
+     */
+    constexpr auto address() const noexcept -> ::picolibrary::I2C::Address_Transmitted
+    {
+        return ::picolibrary::I2C::Address_Transmitted{ static_cast<std::uint8_t>(
+            m_address & ~to_underlying( ::picolibrary::I2C::Operation::READ ) ) };
+    }
+
+    /**
+     * \brief Get the operation to perform once the device has been addressed.
+     *
+     * \return The operation to perform once the device has been addressed.
+     */
+    constexpr auto operation() const noexcept -> ::picolibrary::I2C::Operation
+    {
+        return static_cast<::picolibrary::I2C::Operation>(
+            m_address & to_underlying( ::picolibrary::I2C::Operation::READ ) );
+    }
+
+    /**
+     * \brief Get the transaction's MADDR register value (address and operation).
+     *
+     * \return The transaction's MADDR register value.
+     */
+    constexpr auto maddr() const noexcept -> std::uint8_t
+    {
+        return m_address;
+    }
+
+    /**
+     * \brief Get the beginning of the transaction's block of data.
+     *
+     * \return The beginning of the transaction's block of data.
+     */
+    constexpr auto begin() const noexcept -> std::uint8_t *
+    {
+        return m_begin;
+    }
+
+    /**
+     * \brief Get the end of the transaction's block of data.
+     *
+     * \return The end of the transaction's block of data.
+     */
+    constexpr auto end() const noexcept -> std::uint8_t *
+    {
+        return m_end;
+    }
+
+    /**
+     * \brief Get the transaction's state.
+     *
+     * \return The transaction's state.
+     */
+    auto state() const noexcept -> Transaction_State
+    {
+        return m_state;
+    }
+
+    /**
+     * \brief Check if the transaction is pending (queued or in progress).
+     *
+     * \return true if the transaction is pending.
+     * \return false if the transaction is not pending.
+     */
+    auto pending() const noexcept -> bool
+    {
+        auto const state = m_state;
+
+        return state == Transaction_State::QUEUED
+               or state == Transaction_State::IN_PROGRESS;
+    }
+
+    /**
+     * \brief Set the transaction's state.
+     *
+     * \attention This function is intended to be used by
+     *            picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue.
+     *
+     * \param[in] state The transaction's new state.
+     */
+    void set_state( Transaction_State state ) noexcept
+    {
+        m_state = state;
+    }
+
+  private:
+    /**
+     * \brief The transaction's MADDR register value (address and operation).
+     */
+    std::uint8_t m_address{};
+
+    /**
+     * \brief The beginning of the transaction's block of data.
+     */
+    std::uint8_t * m_begin{};
+
+    /**
+     * \brief The end of the transaction's block of data.
+     */
+    std::uint8_t * m_end{};
+
+    /**
+     * \brief The transaction's state.
+     */
+    Transaction_State volatile m_state{ Transaction_State::IDLE };
+};
+
+/**
+ * \brief Transaction coalescing configuration.
+ */
+enum class Transaction_Coalescing : std::uint8_t {
+    DISABLED, ///< Disabled (each transaction is terminated with a stop condition).
+    ENABLED, ///< Enabled (transactions with the same device are joined by a repeated start).
+};
+
+/**
+ * \brief Transaction queue.
+ *
+ * The transaction queue serializes transactions submitted by multiple device drivers
+ * that share a TWI peripheral. Submitting a transaction does not block, the queue
+ * executes transactions one TWI host interrupt flag at a time from
+ * picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue::service(), which is
+ * intended to be called from the TWI peripheral's host interrupt handler (see
+ * picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue::enable_interrupts()), or
+ * polled from the main loop.
+ *
+ * If transaction coalescing is enabled, a transaction that immediately follows a
+ * successfully completed transaction with the same device is started with a repeated
+ * start condition instead of a stop condition followed by a start condition.
+ *
+ * \tparam CAPACITY The maximum number of queued transactions (must be a power of two no
+ *         larger than 128).
+ */
+template<std::uint_fast8_t CAPACITY>
+class Transaction_Queue {
+  public:
+    static_assert( CAPACITY and CAPACITY <= 128 and not( CAPACITY & ( CAPACITY - 1 ) ) );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Transaction_Queue() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \attention The TWI peripheral's routing configuration must be set prior to using
+     *            this constructor.
+     *
+     * \param[in] twi The TWI peripheral to be used by the transaction queue.
+     * \param[in] twi_sda_hold_time The desired TWI SDA hold time.
+     * \param[in] twi_bus_speed The desired TWI bus speed configuration.
+     * \param[in] twi_clock_generator_scaling_factor The desired TWI clock generator
+     *            scaling factor (MBAUD register value).
+     * \param[in] twi_inactive_bus_time_out The desired TWI inactive bus time-out.
+     * \param[in] transaction_coalescing The desired transaction coalescing
+     *            configuration.
+     */
+    Transaction_Queue(
+        Peripheral::TWI &         twi,
+        TWI_SDA_Hold_Time         twi_sda_hold_time,
+        TWI_Bus_Speed             twi_bus_speed,
+        std::uint8_t              twi_clock_generator_scaling_factor,
+        TWI_Inactive_Bus_Time_Out twi_inactive_bus_time_out,
+        Transaction_Coalescing    transaction_coalescing ) noexcept :
+        m_twi{ &twi },
+        m_transaction_coalescing{ transaction_coalescing }
+    {
+        // #lizard forgives the parameter count
+
+        configure_controller(
+            twi_sda_hold_time, twi_bus_speed, twi_clock_generator_scaling_factor, twi_inactive_bus_time_out );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] twi The TWI peripheral to be used by the transaction queue.
+     * \param[in] twi_sda_hold_time The desired TWI SDA hold time.
+     * \param[in] twi_bus_speed The desired TWI bus speed configuration.
+     * \param[in] twi_clock_generator_scaling_factor The desired TWI clock generator
+     *            scaling factor (MBAUD register value).
+     * \param[in] twi_inactive_bus_time_out The desired TWI inactive bus time-out.
+     * \param[in] transaction_coalescing The desired transaction coalescing
+     *            configuration.
+     * \param[in] twi_route The desired TWI peripheral routing configuration.
+     */
+    Transaction_Queue(
+        Peripheral::TWI &              twi,
+        TWI_SDA_Hold_Time              twi_sda_hold_time,
+        TWI_Bus_Speed                  twi_bus_speed,
+        std::uint8_t                   twi_clock_generator_scaling_factor,
+        TWI_Inactive_Bus_Time_Out      twi_inactive_bus_time_out,
+        Transaction_Coalescing         transaction_coalescing,
+        Multiplexed_Signals::TWI_Route twi_route ) noexcept :
+        m_twi{ &twi },
+        m_transaction_coalescing{ transaction_coalescing }
+    {
+        // #lizard forgives the parameter count
+
+        Multiplexed_Signals::set_twi_route( twi, twi_route );
+
+        configure_controller(
+            twi_sda_hold_time, twi_bus_speed, twi_clock_generator_scaling_factor, twi_inactive_bus_time_out );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam TWI_Instance The TWI peripheral instance to be used by the transaction
+     *         queue.
+     * \tparam TWI_ROUTE The desired TWI peripheral routing configuration.
+     *
+     * \param[in] twi_sda_hold_time The desired TWI SDA hold time.
+     * \param[in] twi_bus_speed The desired TWI bus speed.
+     * \param[in] twi_clock_generator_scaling_factor The desired TWI clock generator
+     *            scaling factor (MBAUD register value).
+     * \param[in] twi_inactive_bus_time_out The desired TWI inactive bus time-out.
+     * \param[in] transaction_coalescing The desired transaction coalescing
+     *            configuration.
+     */
+    template<typename TWI_Instance, Multiplexed_Signals::TWI_Route TWI_ROUTE>
+    Transaction_Queue(
+        Multiplexed_Signals::TWI_Signals<TWI_Instance, TWI_ROUTE>,
+        TWI_SDA_Hold_Time         twi_sda_hold_time,
+        TWI_Bus_Speed             twi_bus_speed,
+        std::uint8_t              twi_clock_generator_scaling_factor,
+        TWI_Inactive_Bus_Time_Out twi_inactive_bus_time_out,
+        Transaction_Coalescing    transaction_coalescing ) noexcept :
+        m_twi{ &TWI_Instance::instance() },
+        m_transaction_coalescing{ transaction_coalescing }
+    {
+        // #lizard forgives the parameter count
+
+        Multiplexed_Signals::TWI_Signals<TWI_Instance, TWI_ROUTE>::set_route();
+
+        configure_controller(
+            twi_sda_hold_time, twi_bus_speed, twi_clock_generator_scaling_factor, twi_inactive_bus_time_out );
+    }
+
+    Transaction_Queue( Transaction_Queue && ) = delete;
+
+    Transaction_Queue( Transaction_Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Transaction_Queue() noexcept
+    {
+        if ( m_twi ) {
+            m_twi->mctrla = 0;
+        } // if
+    }
+
+    auto operator=( Transaction_Queue && ) = delete;
+
+    auto operator=( Transaction_Queue const & ) = delete;
+
+    /**
+     * \brief Initialize the transaction queue's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_twi->mctrla |= Peripheral::TWI::MCTRLA::Mask::ENABLE;
+
+        m_twi->mstatus = Peripheral::TWI::MSTATUS::BUSSTATE_IDLE;
+    }
+
+    /**
+     * \brief Enable the TWI peripheral's host interrupt (read and write).
+     */
+    void enable_interrupts() noexcept
+    {
+        m_twi->mctrla |= Peripheral::TWI::MCTRLA::Mask::RIEN
+                         | Peripheral::TWI::MCTRLA::Mask::WIEN;
+    }
+
+    /**
+     * \brief Disable the TWI peripheral's host interrupt.
+     */
+    void disable_interrupts() noexcept
+    {
+        m_twi->mctrla = m_twi->mctrla
+                        & ~( Peripheral::TWI::MCTRLA::Mask::RIEN
+                             | Peripheral::TWI::MCTRLA::Mask::WIEN );
+    }
+
+    /**
+     * \brief Check if the transaction queue is empty (no transactions are queued or in
+     *        progress).
+     *
+     * \return true if the transaction queue is empty.
+     * \return false if the transaction queue is not empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return m_head == m_tail;
+    }
+
+    /**
+     * \brief Check if the transaction queue is full.
+     *
+     * \return true if the transaction queue is full.
+     * \return false if the transaction queue is not full.
+     */
+    auto full() const noexcept -> bool
+    {
+        return static_cast<std::uint8_t>( m_tail - m_head ) == CAPACITY;
+    }
+
+    /**
+     * \brief Queue a transaction.
+     *
+     * \pre not picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue::full()
+     * \pre not transaction.pending()
+     * \pre a read transaction's block of data is not empty
+     *
+     * \param[in] transaction The transaction to queue.
+     */
+    void enqueue( Transaction & transaction ) noexcept
+    {
+        PICOLIBRARY_EXPECT( not full(), Generic_Error::WOULD_OVERFLOW );
+        PICOLIBRARY_EXPECT( not transaction.pending(), Generic_Error::LOGIC_ERROR );
+        PICOLIBRARY_EXPECT(
+            transaction.operation() == ::picolibrary::I2C::Operation::WRITE
+                or transaction.begin() != transaction.end(),
+            Generic_Error::INVALID_ARGUMENT );
+
+        Interrupt::Controller interrupt_controller;
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+
+        interrupt_controller.disable_interrupt();
+
+        transaction.set_state( Transaction_State::QUEUED );
+
+        m_transactions[ m_tail % CAPACITY ] = &transaction;
+
+        ++m_tail;
+
+        if ( not m_transaction ) {
+            start( transaction );
+        } // if
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+    }
+
+    /**
+     * \brief Advance the execution of the transaction that is in progress (if no
+     *        transaction is in progress, any pending controller read/write interrupt is
+     *        acknowledged so that it does not retrigger).
+     *
+     * \attention This function must not be interrupted by a call to
+     *            picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue::enqueue()
+     *            (call it from the TWI peripheral's host interrupt handler, or with
+     *            interrupts disabled if polling).
+     */
+    void service() noexcept
+    {
+        if ( not m_transaction ) {
+            m_twi->mstatus = Peripheral::TWI::MSTATUS::Mask::RIF
+                             | Peripheral::TWI::MSTATUS::Mask::WIF;
+
+            return;
+        } // if
+
+        std::uint8_t const mstatus = m_twi->mstatus;
+
+        if ( not( mstatus
+                  & ( Peripheral::TWI::MSTATUS::Mask::RIF
+                      | Peripheral::TWI::MSTATUS::Mask::WIF ) ) ) {
+            return;
+        } // if
+
+        if ( mstatus & Peripheral::TWI::MSTATUS::Mask::BUSERR ) {
+            complete( Transaction_State::BUS_ERROR );
+            return;
+        } // if
+
+        if ( mstatus & Peripheral::TWI::MSTATUS::Mask::ARBLOST ) {
+            complete( Transaction_State::ARBITRATION_LOST );
+            return;
+        } // if
+
+        if ( ( mstatus & Peripheral::TWI::MSTATUS::Mask::WIF )
+             and ( mstatus & Peripheral::TWI::MSTATUS::Mask::RXACK ) ) {
+            complete( Transaction_State::NACK );
+            return;
+        } // if
+
+        if ( m_transaction->operation() == ::picolibrary::I2C::Operation::WRITE ) {
+            if ( m_position != m_transaction->end() ) {
+                m_twi->mdata = *m_position;
+
+                ++m_position;
+
+                return;
+            } // if
+
+            complete( Transaction_State::COMPLETE );
+            return;
+        } // if
+
+        auto const last = m_position + 1 == m_transaction->end();
+
+        m_twi->mctrlb = last ? Peripheral::TWI::MCTRLB::ACKACT_NACK
+                             : Peripheral::TWI::MCTRLB::ACKACT_ACK;
+
+        *m_position = m_twi->mdata;
+
+        ++m_position;
+
+        if ( last ) {
+            complete( Transaction_State::COMPLETE );
+        } // if
+    }
+
+  private:
+    /**
+     * \brief The TWI used by the transaction queue.
+     */
+    Peripheral::TWI * m_twi{};
+
+    /**
+     * \brief The transaction coalescing configuration.
+     */
+    Transaction_Coalescing m_transaction_coalescing{};
+
+    /**
+     * \brief The queued transactions.
+     */
+    Transaction * m_transactions[ CAPACITY ]{};
+
+    /**
+     * \brief The index of the oldest queued transaction.
+     */
+    std::uint8_t volatile m_head{};
+
+    /**
+     * \brief The index one past the newest queued transaction.
+     */
+    std::uint8_t volatile m_tail{};
+
+    /**
+     * \brief The transaction that is in progress.
+     */
+    Transaction * m_transaction{};
+
+    /**
+     * \brief The position in the block of data of the transaction that is in progress.
+     */
+    std::uint8_t * m_position{};
+
+    /**
+     * \brief Configure the controller.
+     *
+     * \param[in] twi_sda_hold_time The desired TWI SDA hold time.
+     * \param[in] twi_bus_speed The desired TWI bus speed configuration.
+     * \param[in] twi_clock_generator_scaling_factor The desired TWI clock generator
+     *            scaling factor (MBAUD register value).
+     * \param[in] twi_inactive_bus_time_out The desired TWI inactive bus time-out.
+     */
+    void configure_controller(
+        TWI_SDA_Hold_Time         twi_sda_hold_time,
+        TWI_Bus_Speed             twi_bus_speed,
+        std::uint8_t              twi_clock_generator_scaling_factor,
+        TWI_Inactive_Bus_Time_Out twi_inactive_bus_time_out ) noexcept
+    {
+        m_twi->mbaud  = twi_clock_generator_scaling_factor;
+        m_twi->mctrla = to_underlying( twi_inactive_bus_time_out )
+                        | Peripheral::TWI::MCTRLA::Mask::SMEN;
+        m_twi->ctrla = to_underlying( twi_sda_hold_time ) | to_underlying( twi_bus_speed );
+    }
+
+    /**
+     * \brief Start a transaction (transmits a start condition, or a repeated start
+     *        condition if the bus is owned, followed by the transaction's address).
+     *
+     * \param[in] transaction The transaction to start.
+     */
+    void start( Transaction & transaction ) noexcept
+    {
+        m_transaction = &transaction;
+        m_position    = transaction.begin();
+
+        transaction.set_state( Transaction_State::IN_PROGRESS );
+
+        m_twi->maddr = transaction.maddr();
+    }
+
+    /**
+     * \brief Complete the transaction that is in progress and start the next queued
+     *        transaction.
+     *
+     * \param[in] state The completed transaction's final state.
+     */
+    void complete( Transaction_State state ) noexcept
+    {
+        auto const address = m_transaction->address();
+
+        m_transaction->set_state( state );
+        m_transaction = nullptr;
+
+        ++m_head;
+
+        auto const next = m_head != m_tail ? m_transactions[ m_head % CAPACITY ]
+                                           : nullptr;
+
+        switch ( state ) {
+            case Transaction_State::BUS_ERROR:
+            case Transaction_State::ARBITRATION_LOST:
+                m_twi->mstatus = Peripheral::TWI::MSTATUS::Mask::RIF
+                                 | Peripheral::TWI::MSTATUS::Mask::WIF
+                                 | Peripheral::TWI::MSTATUS::Mask::BUSERR
+                                 | Peripheral::TWI::MSTATUS::Mask::ARBLOST
+                                 | Peripheral::TWI::MSTATUS::BUSSTATE_IDLE;
+                break;
+            case Transaction_State::COMPLETE:
+                if ( next and m_transaction_coalescing == Transaction_Coalescing::ENABLED
+                     and next->address() == address ) {
+                    break;
+                } // if
+                [[fallthrough]];
+            default: m_twi->mctrlb |= Peripheral::TWI::MCTRLB::MCMD_STOP; break;
+        } // switch
+
+        if ( next ) {
+            start( *next );
+        } // if
+    }
+};
+
+/**
+ * \brief Device event.
+ */
+enum class Device_Event : std::uint8_t {
+    NONE,                ///< No event is pending.
+    ADDRESSED_FOR_READ,  ///< The device has been addressed for a read.
+    ADDRESSED_FOR_WRITE, ///< The device has been addressed for a write.
+    DATA_REQUESTED,      ///< The controller is waiting for the device to transmit data.
+    DATA_RECEIVED,       ///< The device has received data from the controller.
+    STOP,                ///< A stop condition has been received.
+    BUS_ERROR,           ///< A bus error has been detected.
+    COLLISION,           ///< The device lost a bus collision while transmitting.
+};
+
+/**
+ * \brief Device (TWI client).
+ *
+ * The device only uses the TWI peripheral's client registers, allowing it to coexist with
+ * a picolibrary::Microchip::megaAVR0::I2C::Basic_Controller that uses the same TWI
+ * peripheral. If the TWI peripheral's dual mode is enabled (see
+ * picolibrary::Microchip::megaAVR0::I2C::enable_dual_mode()), the device operates on the
+ * TWI peripheral's device pins while the controller operates on the TWI peripheral's
+ * controller pins.
+ *
+ * Device operation is event driven. Events can be polled by calling
+ * picolibrary::Microchip::megaAVR0::I2C::Basic_Device::event() in the main loop, or
+ * handled from the TWI peripheral's client interrupt after enabling interrupts using
+ * picolibrary::Microchip::megaAVR0::I2C::Basic_Device::enable_interrupts(). Each event
+ * other than picolibrary::Microchip::megaAVR0::I2C::Device_Event::NONE holds the bus
+ * (clock stretching) until it is handled by calling
+ * picolibrary::Microchip::megaAVR0::I2C::Basic_Device::respond(),
+ * picolibrary::Microchip::megaAVR0::I2C::Basic_Device::transmit(), or
+ * picolibrary::Microchip::megaAVR0::I2C::Basic_Device::complete_transaction().
+ */
+class Basic_Device {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Basic_Device() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \attention The TWI peripheral's routing configuration must be set prior to using
+     *            this constructor.
+     *
+     * \param[in] twi The TWI peripheral to be used by the device.
+     * \param[in] address The device's address.
+     */
+    Basic_Device( Peripheral::TWI &                       twi,
+                  ::picolibrary::I2C::Address_Transmitted address ) noexcept :
+        m_twi{ &twi }
+    {
+        configure_device( address );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] twi The TWI peripheral to be used by the device.
+     * \param[in] address The device's address.
+     * \param[in] twi_route The desired TWI peripheral routing configuration.
+     */
+    Basic_Device(
+        Peripheral::TWI &                       twi,
+        ::picolibrary::I2C::Address_Transmitted address,
+        Multiplexed_Signals::TWI_Route          twi_route ) noexcept :
+        m_twi{ &twi }
+    {
+        Multiplexed_Signals::set_twi_route( twi, twi_route );
+
+        configure_device( address );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Basic_Device( Basic_Device && source ) noexcept : m_twi{ source.m_twi }
+    {
+        source.m_twi = nullptr;
+    }
+
+    Basic_Device( Basic_Device const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Basic_Device() noexcept
+    {
+        disable();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Basic_Device && expression ) noexcept -> Basic_Device &
+    {
+        if ( &expression != this ) {
+            disable();
+
+            m_twi = expression.m_twi;
+
+            expression.m_twi = nullptr;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Basic_Device const & ) = delete;
+
+    /**
+     * \brief Initialize the device's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_twi->sctrla |= Peripheral::TWI::SCTRLA::Mask::ENABLE;
+    }
+
+    /**
+     * \brief Enable the TWI peripheral's client interrupt (address or stop, and data).
+     */
+    void enable_interrupts() noexcept
+    {
+        m_twi->sctrla |= Peripheral::TWI::SCTRLA::Mask::DIEN
+                         | Peripheral::TWI::SCTRLA::Mask::APIEN
+                         | Peripheral::TWI::SCTRLA::Mask::PIEN;
+    }
+
+    /**
+     * \brief Disable the TWI peripheral's client interrupt.
+     */
+    void disable_interrupts() noexcept
+    {
+        m_twi->sctrla = m_twi->sctrla
+                        & ~( Peripheral::TWI::SCTRLA::Mask::DIEN
+                             | Peripheral::TWI::SCTRLA::Mask::APIEN
+                             | Peripheral::TWI::SCTRLA::Mask::PIEN );
+    }
+
+    /**
+     * \brief Get the pending device event.
+     *
+     * \return The pending device event.
+     */
+    auto event() const noexcept -> Device_Event
+    {
+        std::uint8_t const sstatus = m_twi->sstatus;
+
+        if ( sstatus & Peripheral::TWI::SSTATUS::Mask::BUSERR ) {
+            return Device_Event::BUS_ERROR;
+        } // if
+
+        if ( sstatus & Peripheral::TWI::SSTATUS::Mask::COLL ) {
+            return Device_Event::COLLISION;
+        } // if
+
+        if ( sstatus & Peripheral::TWI::SSTATUS::Mask::APIF ) {
+            if ( not( sstatus & Peripheral::TWI::SSTATUS::Mask::AP ) ) {
+                return Device_Event::STOP;
+            } // if
+
+            return sstatus & Peripheral::TWI::SSTATUS::Mask::DIR
+                       ? Device_Event::ADDRESSED_FOR_READ
+                       : Device_Event::ADDRESSED_FOR_WRITE;
+        } // if
+
+        if ( sstatus & Peripheral::TWI::SSTATUS::Mask::DIF ) {
+            return sstatus & Peripheral::TWI::SSTATUS::Mask::DIR
+                       ? Device_Event::DATA_REQUESTED
+                       : Device_Event::DATA_RECEIVED;
+        } // if
+
+        return Device_Event::NONE;
+    }
+
+    /**
+     * \brief Get the address the device was addressed with.
+     *
+     * \pre picolibrary::Microchip::megaAVR0::I2C::Device_Event::ADDRESSED_FOR_READ or
+     *      picolibrary::Microchip::megaAVR0::I2C::Device_Event::ADDRESSED_FOR_WRITE is
+     *      pending
+     *
+     * \return The address the device was addressed with.
+     */
+    auto address() const noexcept -> ::picolibrary::I2C::Address_Transmitted
+    {
+        return ::picolibrary::I2C::Address_Transmitted{ static_cast<std::uint8_t>(
+            m_twi->sdata & ~to_underlying( ::picolibrary::I2C::Operation::READ ) ) };
+    }
+
+    /**
+     * \brief Get data received from the controller.
+     *
+     * \pre picolibrary::Microchip::megaAVR0::I2C::Device_Event::DATA_RECEIVED is pending
+     *
+     * \return The data received from the controller.
+     */
+    auto data() const noexcept -> std::uint8_t
+    {
+        return m_twi->sdata;
+    }
+
+    /**
+     * \brief Respond to an address match or to received data, and release the bus.
+     *
+     * \param[in] response The response to transmit.
+     */
+    void respond( ::picolibrary::I2C::Response response ) noexcept
+    {
+        m_twi->sctrlb = ( response == ::picolibrary::I2C::Response::ACK
+                              ? Peripheral::TWI::SCTRLB::ACKACT_ACK
+                              : Peripheral::TWI::SCTRLB::ACKACT_NACK )
+                        | Peripheral::TWI::SCTRLB::SCMD_RESPONSE;
+    }
+
+    /**
+     * \brief Transmit data to the controller, and release the bus.
+     *
+     * \pre picolibrary::Microchip::megaAVR0::I2C::Device_Event::DATA_REQUESTED is pending
+     *
+     * \param[in] data The data to transmit.
+     */
+    void transmit( std::uint8_t data ) noexcept
+    {
+        m_twi->sdata  = data;
+        m_twi->sctrlb = Peripheral::TWI::SCTRLB::SCMD_RESPONSE;
+    }
+
+    /**
+     * \brief Check if the controller responded to the most recently transmitted data with
+     *        a NACK.
+     *
+     * \return true if a NACK was received.
+     * \return false if an ACK was received.
+     */
+    auto nack_received() const noexcept -> bool
+    {
+        return m_twi->sstatus & Peripheral::TWI::SSTATUS::Mask::RXACK;
+    }
+
+    /**
+     * \brief Complete the current transaction (handles stop conditions, controller NACKs,
+     *        bus errors, and collisions), and release the bus.
+     */
+    void complete_transaction() noexcept
+    {
+        m_twi->sstatus = Peripheral::TWI::SSTATUS::Mask::BUSERR
+                         | Peripheral::TWI::SSTATUS::Mask::COLL;
+        m_twi->sctrlb = Peripheral::TWI::SCTRLB::SCMD_COMPTRANS;
+    }
+
+  private:
+    /**
+     * \brief The TWI used by the device.
+     */
+    Peripheral::TWI * m_twi{};
+
+    /**
+     * \brief Disable the device.
+     */
+    constexpr void disable() noexcept
+    {
+        if ( m_twi ) {
+            disable_device();
+        } // if
+    }
+
+    /**
+     * \brief Configure the device.
+     *
+     * \param[in] address The device's address.
+     */
+    void configure_device( ::picolibrary::I2C::Address_Transmitted address ) noexcept
+    {
+        m_twi->saddr     = address.as_unsigned_integer();
+        m_twi->saddrmask = 0;
+        m_twi->sctrla    = 0;
+    }
+
+    /**
+     * \brief Disable the device.
+     */
+    void disable_device() noexcept
+    {
+        m_twi->sctrla = 0;
+    }
+};
+
 } // namespace picolibrary::Microchip::megaAVR0::I2C
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_I2C_H
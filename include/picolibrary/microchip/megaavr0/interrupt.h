@@ -25,6 +25,10 @@
 
 #include <avr-libcpp/interrupt>
 #include <cstdint>
+#include <type_traits>
+
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/utility.h"
 
 /**
  * \brief Microchip megaAVR 0-series interrupt facilities.
@@ -138,6 +142,1354 @@ class Controller {
     static constexpr auto CPU_SREG_ADDRESS = std::uintptr_t{ CPU_ADDRESS + CPU_SREG_OFFSET };
 };
 
-} // namespace picolibrary::Microchip::megaAVR0::Interrupt
+/**
+ * \brief Interrupt source.
+ */
+enum class Source : std::uint8_t {
+    NMI,          ///< CRCSCAN non-maskable interrupt.
+    VLM,          ///< BOD voltage level monitor.
+    CNT,          ///< RTC counter overflow/compare match.
+    PIT,          ///< RTC periodic interrupt timer.
+    CCL,          ///< CCL.
+    PORT,         ///< PORT pin interrupt.
+    RESRDY,       ///< ADC result ready.
+    WCOMP,        ///< ADC window comparator.
+    AC,           ///< AC comparator output toggle.
+    RXC,          ///< USART receive complete.
+    DRE,          ///< USART data register empty.
+    TXC,          ///< USART transmit complete.
+    TWIS,         ///< TWI client.
+    TWIM,         ///< TWI host.
+    INT,          ///< SPI/TCB.
+    OVF,          ///< TCA overflow.
+    LUNF = OVF,   ///< TCA low byte timer underflow (split mode).
+    HUNF,         ///< TCA high byte timer underflow (split mode).
+    CMP0,         ///< TCA compare channel 0.
+    LCMP0 = CMP0, ///< TCA low byte compare channel 0 (split mode).
+    CMP1,         ///< TCA compare channel 1.
+    LCMP1 = CMP1, ///< TCA low byte compare channel 1 (split mode).
+    CMP2,         ///< TCA compare channel 2.
+    LCMP2 = CMP2, ///< TCA low byte compare channel 2 (split mode).
+    EE,           ///< NVMCTRL EEPROM ready.
+};
+
+/**
+ * \brief Interrupt vector.
+ *
+ * \tparam Peripheral_Instance The peripheral instance (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::USART0) that is the source of the
+ *         interrupt.
+ * \tparam SOURCE The peripheral's interrupt source.
+ *
+ * \attention Only the peripheral instance and interrupt source combinations that the
+ *            device supports have a definition.
+ */
+template<typename Peripheral_Instance, Source SOURCE>
+struct Vector;
+
+/**
+ * \brief CRCSCAN0 NMI interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::CRCSCAN0, Source::NMI> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ CRCSCAN_NMI_vect_num };
+};
+
+/**
+ * \brief BOD0 VLM interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::BOD0, Source::VLM> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ BOD_VLM_vect_num };
+};
+
+/**
+ * \brief RTC0 CNT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::RTC0, Source::CNT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ RTC_CNT_vect_num };
+};
+
+/**
+ * \brief RTC0 PIT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::RTC0, Source::PIT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ RTC_PIT_vect_num };
+};
+
+/**
+ * \brief CCL0 CCL interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::CCL0, Source::CCL> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ CCL_CCL_vect_num };
+};
+
+/**
+ * \brief PORTA PORT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::PORTA, Source::PORT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ PORTA_PORT_vect_num };
+};
+
+#if defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) \
+    || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief PORTB PORT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::PORTB, Source::PORT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ PORTB_PORT_vect_num };
+};
+
+#endif // defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief PORTC PORT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::PORTC, Source::PORT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ PORTC_PORT_vect_num };
+};
+
+/**
+ * \brief PORTD PORT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::PORTD, Source::PORT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ PORTD_PORT_vect_num };
+};
+
+#if defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) \
+    || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief PORTE PORT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::PORTE, Source::PORT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ PORTE_PORT_vect_num };
+};
+
+#endif // defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief PORTF PORT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::PORTF, Source::PORT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ PORTF_PORT_vect_num };
+};
+
+/**
+ * \brief ADC0 RESRDY interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::ADC0, Source::RESRDY> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ ADC0_RESRDY_vect_num };
+};
+
+/**
+ * \brief ADC0 WCOMP interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::ADC0, Source::WCOMP> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ ADC0_WCOMP_vect_num };
+};
+
+/**
+ * \brief AC0 AC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::AC0, Source::AC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ AC0_AC_vect_num };
+};
+
+/**
+ * \brief USART0 RXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART0, Source::RXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART0_RXC_vect_num };
+};
+
+/**
+ * \brief USART0 DRE interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART0, Source::DRE> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART0_DRE_vect_num };
+};
+
+/**
+ * \brief USART0 TXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART0, Source::TXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART0_TXC_vect_num };
+};
+
+/**
+ * \brief USART1 RXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART1, Source::RXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART1_RXC_vect_num };
+};
+
+/**
+ * \brief USART1 DRE interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART1, Source::DRE> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART1_DRE_vect_num };
+};
+
+/**
+ * \brief USART1 TXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART1, Source::TXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART1_TXC_vect_num };
+};
+
+/**
+ * \brief USART2 RXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART2, Source::RXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART2_RXC_vect_num };
+};
+
+/**
+ * \brief USART2 DRE interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART2, Source::DRE> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART2_DRE_vect_num };
+};
+
+/**
+ * \brief USART2 TXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART2, Source::TXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART2_TXC_vect_num };
+};
+
+#if defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) \
+    || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief USART3 RXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART3, Source::RXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART3_RXC_vect_num };
+};
+
+#endif // defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+#if defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) \
+    || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief USART3 DRE interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART3, Source::DRE> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART3_DRE_vect_num };
+};
+
+#endif // defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+#if defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) \
+    || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief USART3 TXC interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::USART3, Source::TXC> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ USART3_TXC_vect_num };
+};
+
+#endif // defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief TWI0 TWIS interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TWI0, Source::TWIS> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TWI0_TWIS_vect_num };
+};
+
+/**
+ * \brief TWI0 TWIM interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TWI0, Source::TWIM> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TWI0_TWIM_vect_num };
+};
+
+/**
+ * \brief SPI0 INT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::SPI0, Source::INT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ SPI0_INT_vect_num };
+};
+
+/**
+ * \brief TCA0 OVF interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCA0, Source::OVF> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCA0_OVF_vect_num };
+};
+
+/**
+ * \brief TCA0 HUNF interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCA0, Source::HUNF> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCA0_HUNF_vect_num };
+};
+
+/**
+ * \brief TCA0 CMP0 interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCA0, Source::CMP0> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCA0_CMP0_vect_num };
+};
+
+/**
+ * \brief TCA0 CMP1 interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCA0, Source::CMP1> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCA0_CMP1_vect_num };
+};
+
+/**
+ * \brief TCA0 CMP2 interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCA0, Source::CMP2> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCA0_CMP2_vect_num };
+};
+
+/**
+ * \brief TCB0 INT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCB0, Source::INT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCB0_INT_vect_num };
+};
+
+/**
+ * \brief TCB1 INT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCB1, Source::INT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCB1_INT_vect_num };
+};
+
+/**
+ * \brief TCB2 INT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCB2, Source::INT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCB2_INT_vect_num };
+};
+
+#if defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) \
+    || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief TCB3 INT interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::TCB3, Source::INT> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ TCB3_INT_vect_num };
+};
+
+#endif // defined( __AVR_ATmega809__ ) || defined( __AVR_ATmega1609__ ) || defined( __AVR_ATmega3209__ ) || defined( __AVR_ATmega4809__ )
+
+/**
+ * \brief NVMCTRL0 EE interrupt vector.
+ */
+template<>
+struct Vector<Peripheral::NVMCTRL0, Source::EE> {
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto NUMBER = std::uint_fast8_t{ NVMCTRL_EE_vect_num };
+};
+
+/**
+ * \brief Interrupt handler binding (driver member function handler).
+ *
+ * \tparam Peripheral_Instance The peripheral instance (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::USART0) that is the source of the
+ *         interrupt.
+ * \tparam SOURCE The peripheral's interrupt source.
+ * \tparam DRIVER The driver that handles the interrupt. The driver must have static
+ *         storage duration.
+ * \tparam HANDLER The driver member function that handles the interrupt.
+ *
+ * Since the driver and the handler are template parameters, the handler is called
+ * directly (no virtual dispatch or function pointer indirection), and can be inlined into
+ * the interrupt service routine emitted by
+ * PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND().
+ */
+template<typename Peripheral_Instance, Source SOURCE, auto & DRIVER, auto HANDLER>
+class Binding {
+  public:
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto VECTOR_NUMBER = Vector<Peripheral_Instance, SOURCE>::NUMBER;
+
+    Binding() = delete;
+
+    /**
+     * \brief Handle the interrupt.
+     */
+    static void handle() noexcept
+    {
+        ( DRIVER.*HANDLER )();
+    }
+};
+
+/**
+ * \brief Interrupt handler binding (static handler).
+ *
+ * \tparam Peripheral_Instance The peripheral instance (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::TCB0) that is the source of the
+ *         interrupt.
+ * \tparam SOURCE The peripheral's interrupt source.
+ * \tparam HANDLER The function (or static member function) that handles the interrupt.
+ */
+template<typename Peripheral_Instance, Source SOURCE, auto HANDLER>
+class Static_Binding {
+  public:
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto VECTOR_NUMBER = Vector<Peripheral_Instance, SOURCE>::NUMBER;
+
+    Static_Binding() = delete;
+
+    /**
+     * \brief Handle the interrupt.
+     */
+    static void handle() noexcept
+    {
+        HANDLER();
+    }
+};
+
+/**
+ * \brief Get the interrupt vector number of an interrupt vector symbol.
+ *
+ * \param[in] symbol The interrupt vector symbol (e.g. "__vector_19").
+ *
+ * \return The interrupt vector number of the interrupt vector symbol.
+ */
+constexpr auto vector_number( char const * symbol ) noexcept -> std::uint_fast8_t
+{
+    auto number = std::uint_fast8_t{};
+
+    for ( ; *symbol; ++symbol ) {
+        if ( *symbol >= '0' and *symbol <= '9' ) {
+            number = number * 10 + ( *symbol - '0' );
+        } else {
+            number = 0;
+        } // else
+    }     // for
+
+    return number;
+}
+
+/**
+ * \brief Check if a level 0 (normal priority) interrupt is executing.
+ *
+ * \return true if a level 0 interrupt is executing.
+ * \return false if a level 0 interrupt is not executing.
+ */
+inline auto level_0_interrupt_executing() noexcept -> bool
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return cpuint.status & Peripheral::CPUINT::STATUS::Mask::LVL0EX;
+}
+
+/**
+ * \brief Check if a level 1 (high priority) interrupt is executing.
+ *
+ * \return true if a level 1 interrupt is executing.
+ * \return false if a level 1 interrupt is not executing.
+ */
+inline auto level_1_interrupt_executing() noexcept -> bool
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return cpuint.status & Peripheral::CPUINT::STATUS::Mask::LVL1EX;
+}
+
+/**
+ * \brief Check if a non-maskable interrupt is executing.
+ *
+ * \return true if a non-maskable interrupt is executing.
+ * \return false if a non-maskable interrupt is not executing.
+ */
+inline auto non_maskable_interrupt_executing() noexcept -> bool
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return cpuint.status & Peripheral::CPUINT::STATUS::Mask::NMIEX;
+}
+
+/**
+ * \brief Get the level 1 (high priority) interrupt vector number.
+ *
+ * \return The level 1 interrupt vector number (0 if no interrupt vector has been
+ *         assigned level 1 priority).
+ */
+inline auto level_1_vector() noexcept -> std::uint_fast8_t
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return cpuint.lvl1vec;
+}
+
+/**
+ * \brief Assign level 1 (high priority) to an interrupt vector.
+ *
+ * \param[in] vector_number The number of the interrupt vector to assign level 1 priority
+ *            to (0 to assign level 1 priority to no interrupt vector).
+ *
+ * \attention Only a single interrupt vector can have level 1 priority. Assigning level 1
+ *            priority to an interrupt vector restores level 0 priority to the interrupt
+ *            vector that previously had level 1 priority.
+ */
+inline void set_level_1_vector( std::uint_fast8_t vector_number ) noexcept
+{
+    auto & cpuint = Peripheral::CPUINT0::instance();
+
+    cpuint.lvl1vec = vector_number;
+}
+
+/**
+ * \brief Assign level 1 (high priority) to an interrupt vector.
+ *
+ * \tparam Peripheral_Instance The peripheral instance (e.g.
+ *         picolibrary::Microchip::megaAVR0::Peripheral::TCA0) that is the source of the
+ *         interrupt.
+ * \tparam SOURCE The peripheral's interrupt source.
+ *
+ * \attention Only a single interrupt vector can have level 1 priority. Assigning level 1
+ *            priority to an interrupt vector restores level 0 priority to the interrupt
+ *            vector that previously had level 1 priority.
+ */
+template<typename Peripheral_Instance, Source SOURCE>
+void set_level_1_vector() noexcept
+{
+    set_level_1_vector( Vector<Peripheral_Instance, SOURCE>::NUMBER );
+}
+
+/**
+ * \brief Restore level 0 (normal priority) to the interrupt vector that has level 1
+ *        (high priority) priority.
+ */
+inline void clear_level_1_vector() noexcept
+{
+    set_level_1_vector( 0 );
+}
+
+/**
+ * \brief Check if level 0 (normal priority) round robin scheduling is enabled.
+ *
+ * \return true if level 0 round robin scheduling is enabled.
+ * \return false if level 0 round robin scheduling is not enabled.
+ */
+inline auto round_robin_scheduling_enabled() noexcept -> bool
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return cpuint.ctrla & Peripheral::CPUINT::CTRLA::Mask::LVL0RR;
+}
+
+/**
+ * \brief Enable level 0 (normal priority) round robin scheduling.
+ *
+ * When round robin scheduling is enabled, the interrupt vector that was most recently
+ * acknowledged is given the lowest level 0 priority, which prevents interrupt vectors
+ * with low interrupt vector numbers from starving interrupt vectors with high interrupt
+ * vector numbers.
+ */
+inline void enable_round_robin_scheduling() noexcept
+{
+    auto & cpuint = Peripheral::CPUINT0::instance();
+
+    cpuint.ctrla |= Peripheral::CPUINT::CTRLA::Mask::LVL0RR;
+}
+
+/**
+ * \brief Disable level 0 (normal priority) round robin scheduling.
+ */
+inline void disable_round_robin_scheduling() noexcept
+{
+    auto & cpuint = Peripheral::CPUINT0::instance();
+
+    cpuint.ctrla &= ~Peripheral::CPUINT::CTRLA::Mask::LVL0RR;
+}
+
+/**
+ * \brief Get the number of the interrupt vector that has the lowest level 0 (normal
+ *        priority) priority.
+ *
+ * \return The number of the interrupt vector that has the lowest level 0 priority.
+ */
+inline auto level_0_lowest_priority_vector() noexcept -> std::uint_fast8_t
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return cpuint.lvl0pri;
+}
+
+/**
+ * \brief Set the number of the interrupt vector that has the lowest level 0 (normal
+ *        priority) priority.
+ *
+ * \param[in] vector_number The number of the interrupt vector that will have the lowest
+ *            level 0 priority. The interrupt vector with the next interrupt vector number
+ *            will have the highest level 0 priority.
+ *
+ * \attention If level 0 round robin scheduling is enabled, the lowest level 0 priority
+ *            interrupt vector is updated by hardware each time a level 0 interrupt is
+ *            acknowledged.
+ */
+inline void set_level_0_lowest_priority_vector( std::uint_fast8_t vector_number ) noexcept
+{
+    auto & cpuint = Peripheral::CPUINT0::instance();
+
+    cpuint.lvl0pri = vector_number;
+}
+
+/**
+ * \brief Check if the compact vector table is enabled.
+ *
+ * \return true if the compact vector table is enabled.
+ * \return false if the compact vector table is not enabled.
+ */
+inline auto compact_vector_table_enabled() noexcept -> bool
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return cpuint.ctrla & Peripheral::CPUINT::CTRLA::Mask::CVT;
+}
+
+/**
+ * \brief Enable the compact vector table.
+ *
+ * When the compact vector table is enabled, all level 1 (high priority) interrupts are
+ * handled by the PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_COMPACT_VECTOR_TABLE_LEVEL_1_VECTOR
+ * interrupt vector, and all level 0 (normal priority) interrupts are handled by the
+ * PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_COMPACT_VECTOR_TABLE_LEVEL_0_VECTOR interrupt
+ * vector.
+ *
+ * \attention Interrupts should be disabled when the compact vector table is enabled or
+ *            disabled.
+ */
+inline void enable_compact_vector_table() noexcept
+{
+    auto & cpuint = Peripheral::CPUINT0::instance();
+
+    cpuint.ctrla |= Peripheral::CPUINT::CTRLA::Mask::CVT;
+}
+
+/**
+ * \brief Disable the compact vector table.
+ *
+ * \attention Interrupts should be disabled when the compact vector table is enabled or
+ *            disabled.
+ */
+inline void disable_compact_vector_table() noexcept
+{
+    auto & cpuint = Peripheral::CPUINT0::instance();
+
+    cpuint.ctrla &= ~Peripheral::CPUINT::CTRLA::Mask::CVT;
+}
+
+/**
+ * \brief Vector table location.
+ */
+enum class Vector_Table_Location : std::uint8_t {
+    APPLICATION_CODE_SECTION = 0b0 << Peripheral::CPUINT::CTRLA::Bit::IVSEL, ///< Application code section.
+    BOOT_SECTION             = 0b1 << Peripheral::CPUINT::CTRLA::Bit::IVSEL, ///< Boot section.
+};
+
+/**
+ * \brief Get the vector table location.
+ *
+ * \return The vector table location.
+ */
+inline auto vector_table_location() noexcept -> Vector_Table_Location
+{
+    auto const & cpuint = Peripheral::CPUINT0::instance();
+
+    return static_cast<Vector_Table_Location>(
+        cpuint.ctrla & Peripheral::CPUINT::CTRLA::Mask::IVSEL );
+}
+
+/**
+ * \brief Set the vector table location.
+ *
+ * \param[in] location The desired vector table location.
+ *
+ * \attention Interrupts should be disabled when the vector table location is changed.
+ */
+inline void set_vector_table_location( Vector_Table_Location location ) noexcept
+{
+    auto & cpuint = Peripheral::CPUINT0::instance();
+
+    cpuint.ctrla = ( cpuint.ctrla & ~Peripheral::CPUINT::CTRLA::Mask::IVSEL )
+                   | to_underlying( location );
+}
+
+/**
+ * \brief Global critical section guard.
+ *
+ * Interrupts are disabled when the guard is constructed, and the previously saved
+ * interrupts enable state is restored when the guard is destroyed.
+ */
+class Critical_Section {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Critical_Section() noexcept :
+        m_interrupt_enable_state{ Controller{}.save_interrupt_enable_state() }
+    {
+        Controller{}.disable_interrupt();
+    }
+
+    Critical_Section( Critical_Section && ) = delete;
+
+    Critical_Section( Critical_Section const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Critical_Section() noexcept
+    {
+        Controller{}.restore_interrupt_enable_state( m_interrupt_enable_state );
+    }
+
+    auto operator=( Critical_Section && ) = delete;
+
+    auto operator=( Critical_Section const & ) = delete;
+
+  private:
+    /**
+     * \brief The interrupts enable state when the guard was constructed.
+     */
+    Controller::Interrupt_Enable_State m_interrupt_enable_state;
+};
+
+/**
+ * \brief Peripheral interrupt source enable bits.
+ *
+ * \tparam Peripheral_Type The type of the peripheral that is the source of the interrupt
+ *         (e.g. picolibrary::Microchip::megaAVR0::Peripheral::USART).
+ * \tparam SOURCE The peripheral's interrupt source.
+ *
+ * \attention Only the peripheral type and interrupt source combinations that can be
+ *            selectively masked have a definition.
+ */
+template<typename Peripheral_Type, Source SOURCE>
+struct Enable_Bits;
+
+/**
+ * \brief USART RXC interrupt enable bits (RXCIE, RXSIE, and ABEIE).
+ */
+template<>
+struct Enable_Bits<Peripheral::USART, Source::RXC> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{
+        Peripheral::USART::CTRLA::Mask::RXCIE
+        | Peripheral::USART::CTRLA::Mask::RXSIE
+        | Peripheral::USART::CTRLA::Mask::ABEIE };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::USART & peripheral ) noexcept
+        -> Peripheral::USART::CTRLA &
+    {
+        return peripheral.ctrla;
+    }
+};
+
+/**
+ * \brief USART DRE interrupt enable bit (DREIE).
+ */
+template<>
+struct Enable_Bits<Peripheral::USART, Source::DRE> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{ Peripheral::USART::CTRLA::Mask::DREIE };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::USART & peripheral ) noexcept
+        -> Peripheral::USART::CTRLA &
+    {
+        return peripheral.ctrla;
+    }
+};
+
+/**
+ * \brief USART TXC interrupt enable bit (TXCIE).
+ */
+template<>
+struct Enable_Bits<Peripheral::USART, Source::TXC> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{ Peripheral::USART::CTRLA::Mask::TXCIE };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::USART & peripheral ) noexcept
+        -> Peripheral::USART::CTRLA &
+    {
+        return peripheral.ctrla;
+    }
+};
+
+/**
+ * \brief TWI TWIS interrupt enable bits (DIEN, APIEN, and PIEN).
+ */
+template<>
+struct Enable_Bits<Peripheral::TWI, Source::TWIS> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{
+        Peripheral::TWI::SCTRLA::Mask::DIEN
+        | Peripheral::TWI::SCTRLA::Mask::APIEN
+        | Peripheral::TWI::SCTRLA::Mask::PIEN };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::TWI & peripheral ) noexcept
+        -> Peripheral::TWI::SCTRLA &
+    {
+        return peripheral.sctrla;
+    }
+};
+
+/**
+ * \brief TWI TWIM interrupt enable bits (RIEN and WIEN).
+ */
+template<>
+struct Enable_Bits<Peripheral::TWI, Source::TWIM> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{
+        Peripheral::TWI::MCTRLA::Mask::RIEN
+        | Peripheral::TWI::MCTRLA::Mask::WIEN };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::TWI & peripheral ) noexcept
+        -> Peripheral::TWI::MCTRLA &
+    {
+        return peripheral.mctrla;
+    }
+};
+
+/**
+ * \brief SPI INT interrupt enable bits (IE, SSIE, DREIE, TXCIE, and RXCIE).
+ */
+template<>
+struct Enable_Bits<Peripheral::SPI, Source::INT> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{
+        Peripheral::SPI::INTCTRL::Mask::IE
+        | Peripheral::SPI::INTCTRL::Mask::SSIE
+        | Peripheral::SPI::INTCTRL::Mask::DREIE
+        | Peripheral::SPI::INTCTRL::Mask::TXCIE
+        | Peripheral::SPI::INTCTRL::Mask::RXCIE };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::SPI & peripheral ) noexcept
+        -> Peripheral::SPI::INTCTRL &
+    {
+        return peripheral.intctrl;
+    }
+};
+
+/**
+ * \brief TCB INT interrupt enable bit (CAPT).
+ */
+template<>
+struct Enable_Bits<Peripheral::TCB, Source::INT> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{ Peripheral::TCB::INTCTRL::Mask::CAPT };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::TCB & peripheral ) noexcept
+        -> Peripheral::TCB::INTCTRL &
+    {
+        return peripheral.intctrl;
+    }
+};
+
+/**
+ * \brief ADC RESRDY interrupt enable bit (RESRDY).
+ */
+template<>
+struct Enable_Bits<Peripheral::ADC, Source::RESRDY> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{ Peripheral::ADC::INTCTRL::Mask::RESRDY };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::ADC & peripheral ) noexcept
+        -> Peripheral::ADC::INTCTRL &
+    {
+        return peripheral.intctrl;
+    }
+};
+
+/**
+ * \brief ADC WCOMP interrupt enable bit (WCMP).
+ */
+template<>
+struct Enable_Bits<Peripheral::ADC, Source::WCOMP> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{ Peripheral::ADC::INTCTRL::Mask::WCMP };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::ADC & peripheral ) noexcept
+        -> Peripheral::ADC::INTCTRL &
+    {
+        return peripheral.intctrl;
+    }
+};
+
+/**
+ * \brief AC AC interrupt enable bit (CMP).
+ */
+template<>
+struct Enable_Bits<Peripheral::AC, Source::AC> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{ Peripheral::AC::INTCTRL::Mask::CMP };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::AC & peripheral ) noexcept
+        -> Peripheral::AC::INTCTRL &
+    {
+        return peripheral.intctrl;
+    }
+};
+
+/**
+ * \brief RTC CNT interrupt enable bits (OVF and CMP).
+ */
+template<>
+struct Enable_Bits<Peripheral::RTC, Source::CNT> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{
+        Peripheral::RTC::INTCTRL::Mask::OVF
+        | Peripheral::RTC::INTCTRL::Mask::CMP };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::RTC & peripheral ) noexcept
+        -> Peripheral::RTC::INTCTRL &
+    {
+        return peripheral.intctrl;
+    }
+};
+
+/**
+ * \brief RTC PIT interrupt enable bit (PI).
+ */
+template<>
+struct Enable_Bits<Peripheral::RTC, Source::PIT> {
+    /**
+     * \brief The interrupt enable bits mask.
+     */
+    static constexpr auto MASK = std::uint8_t{ Peripheral::RTC::PITINTCTRL::Mask::PI };
+
+    /**
+     * \brief Get the register that contains the interrupt enable bits.
+     *
+     * \param[in] peripheral The peripheral.
+     *
+     * \return The register that contains the interrupt enable bits.
+     */
+    static auto enable_register( Peripheral::RTC & peripheral ) noexcept
+        -> Peripheral::RTC::PITINTCTRL &
+    {
+        return peripheral.pitintctrl;
+    }
+};
+
+/**
+ * \brief Peripheral interrupt source critical section guard.
+ *
+ * \tparam Peripheral_Instance The peripheral instance that is the source of the
+ *         interrupt (e.g. picolibrary::Microchip::megaAVR0::Peripheral::USART0).
+ * \tparam SOURCE The peripheral's interrupt source.
+ *
+ * The interrupt source's enable bits are cleared when the guard is constructed, and the
+ * enable bits that were set when the guard was constructed are set when the guard is
+ * destroyed. Only the interrupt source's handler is blocked while the guard exists, so
+ * the guarded region does not add latency to other interrupts.
+ *
+ * \attention The interrupt source's enable bits must not be changed while the guard
+ *            exists. Use
+ *            picolibrary::Microchip::megaAVR0::Interrupt::Masked_Critical_Section::enable_on_exit()
+ *            to enable the interrupt source when the guard is destroyed.
+ */
+template<typename Peripheral_Instance, Source SOURCE>
+class Masked_Critical_Section {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Masked_Critical_Section() noexcept : m_enabled{ mask() }
+    {
+    }
+
+    Masked_Critical_Section( Masked_Critical_Section && ) = delete;
+
+    Masked_Critical_Section( Masked_Critical_Section const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Masked_Critical_Section() noexcept
+    {
+        unmask( m_enabled );
+    }
+
+    auto operator=( Masked_Critical_Section && ) = delete;
+
+    auto operator=( Masked_Critical_Section const & ) = delete;
+
+    /**
+     * \brief Enable the interrupt source when the guard is destroyed, even if the
+     *        interrupt source was not enabled when the guard was constructed.
+     */
+    void enable_on_exit() noexcept
+    {
+        m_enabled = Enable::MASK;
+    }
+
+  private:
+    /**
+     * \brief The interrupt source's enable bits.
+     */
+    using Enable = Enable_Bits<
+        std::remove_reference_t<decltype( Peripheral_Instance::instance() )>,
+        SOURCE>;
+
+    /**
+     * \brief The interrupt source's enable bits that are to be set when the guard is
+     *        destroyed.
+     */
+    std::uint8_t m_enabled;
+
+    /**
+     * \brief Clear the interrupt source's enable bits.
+     *
+     * \return The interrupt source's enable bits that were set.
+     */
+    static auto mask() noexcept -> std::uint8_t
+    {
+        // other handlers of the same peripheral may modify the register
+        Critical_Section const critical_section;
+
+        auto & enable_register = Enable::enable_register(
+            Peripheral_Instance::instance() );
+
+        std::uint8_t const enabled = enable_register & Enable::MASK;
+
+        enable_register &= static_cast<std::uint8_t>( ~Enable::MASK );
+
+        return enabled;
+    }
+
+    /**
+     * \brief Set interrupt source enable bits.
+     *
+     * \param[in] enabled The interrupt source enable bits to set.
+     */
+    static void unmask( std::uint8_t enabled ) noexcept
+    {
+        if ( not enabled ) {
+            return;
+        } // if
+
+        Critical_Section const critical_section;
+
+        Enable::enable_register( Peripheral_Instance::instance() ) |= enabled;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::Interrupt
+
+/**
+ * \brief The compact vector table non-maskable interrupt vector.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_COMPACT_VECTOR_TABLE_NMI_VECTOR _VECTOR( 1 )
+
+/**
+ * \brief The compact vector table level 1 (high priority) interrupt vector.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_COMPACT_VECTOR_TABLE_LEVEL_1_VECTOR _VECTOR( 2 )
+
+/**
+ * \brief The compact vector table level 0 (normal priority) interrupt vector.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_COMPACT_VECTOR_TABLE_LEVEL_0_VECTOR _VECTOR( 3 )
+
+/**
+ * \brief Convert a macro argument to a string literal after expanding it.
+ *
+ * \param[in] argument The macro argument to expand and convert.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_STRINGIFY( argument ) \
+    PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_STRINGIFY_EXPANDED( argument )
+
+/**
+ * \brief Convert an expanded macro argument to a string literal.
+ *
+ * \param[in] argument The expanded macro argument to convert.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_STRINGIFY_EXPANDED( argument ) #argument
+
+/**
+ * \brief Emit an interrupt service routine that calls an interrupt handler binding's
+ *        handler.
+ *
+ * \param[in] vector The interrupt vector (e.g. USART0_DRE_vect).
+ * \param[in] ... The interrupt handler binding
+ *            (picolibrary::Microchip::megaAVR0::Interrupt::Binding or
+ *            picolibrary::Microchip::megaAVR0::Interrupt::Static_Binding).
+ *
+ * A compilation error occurs if the interrupt vector does not match the interrupt handler
+ * binding's peripheral instance and interrupt source.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND( vector, ... )       \
+    static_assert(                                                         \
+        ::picolibrary::Microchip::megaAVR0::Interrupt::vector_number(      \
+            PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_STRINGIFY( vector ) ) \
+            == __VA_ARGS__::VECTOR_NUMBER,                                 \
+        "interrupt vector does not match binding" );                       \
+    ISR( vector )                                                          \
+    {                                                                      \
+        __VA_ARGS__::handle();                                             \
+    }
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_H
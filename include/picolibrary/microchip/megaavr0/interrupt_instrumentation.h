@@ -0,0 +1,468 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Interrupt instrumentation interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_INSTRUMENTATION_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_INSTRUMENTATION_H
+
+#include <cstdint>
+#include <limits>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral/tcb.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::megaAVR0::Interrupt {
+
+/**
+ * \brief Interrupt timing statistics.
+ */
+class Statistics {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Statistics() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Statistics( Statistics && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Statistics( Statistics const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Statistics() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Statistics && expression ) noexcept -> Statistics & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Statistics const & expression ) noexcept -> Statistics & = default;
+
+    /**
+     * \brief Get the number of samples.
+     *
+     * \return The number of samples.
+     */
+    constexpr auto count() const noexcept -> std::uint32_t
+    {
+        return m_count;
+    }
+
+    /**
+     * \brief Get the minimum sample.
+     *
+     * \return The minimum sample (std::numeric_limits<std::uint16_t>::max() if there are
+     *         no samples).
+     */
+    constexpr auto minimum() const noexcept -> std::uint16_t
+    {
+        return m_minimum;
+    }
+
+    /**
+     * \brief Get the maximum sample.
+     *
+     * \return The maximum sample (0 if there are no samples).
+     */
+    constexpr auto maximum() const noexcept -> std::uint16_t
+    {
+        return m_maximum;
+    }
+
+    /**
+     * \brief Get the sum of the samples.
+     *
+     * \return The sum of the samples.
+     */
+    constexpr auto total() const noexcept -> std::uint32_t
+    {
+        return m_total;
+    }
+
+    /**
+     * \brief Add a sample.
+     *
+     * \param[in] cycles The sample.
+     */
+    constexpr void update( std::uint16_t cycles ) noexcept
+    {
+        ++m_count;
+        m_total += cycles;
+
+        if ( cycles < m_minimum ) {
+            m_minimum = cycles;
+        } // if
+
+        if ( cycles > m_maximum ) {
+            m_maximum = cycles;
+        } // if
+    }
+
+  private:
+    /**
+     * \brief The number of samples.
+     */
+    std::uint32_t m_count{};
+
+    /**
+     * \brief The sum of the samples.
+     */
+    std::uint32_t m_total{};
+
+    /**
+     * \brief The minimum sample.
+     */
+    std::uint16_t m_minimum{ std::numeric_limits<std::uint16_t>::max() };
+
+    /**
+     * \brief The maximum sample.
+     */
+    std::uint16_t m_maximum{};
+};
+
+/**
+ * \brief Interrupt profiler.
+ *
+ * \tparam TCB_Instance The TCB peripheral instance used as the profiler's free-running
+ *         counter (e.g. picolibrary::Microchip::megaAVR0::Peripheral::TCB0).
+ * \tparam VECTOR_NUMBERS The numbers of the interrupt vectors that are profiled.
+ *
+ * The profiler keeps duration and latency statistics, in peripheral clock (CLK_PER)
+ * cycles, for each profiled interrupt vector. Durations are recorded by
+ * picolibrary::Microchip::megaAVR0::Interrupt::Profiler::Scope (or
+ * picolibrary::Microchip::megaAVR0::Interrupt::Instrumented_Binding), and include the
+ * cost of reading the free-running counter. Latencies are recorded by interrupt
+ * handlers that know when their interrupt was requested (e.g. a timer interrupt handler
+ * can use its timer's count).
+ *
+ * \attention Interrupt handlers that are not profiled must not access the profiler's TCB
+ *            16-bit registers, and profiled level 0 and level 1 interrupt handlers must
+ *            not both access 16-bit registers of the same TCB, since 16-bit register
+ *            accesses use the TCB's shared TEMP register.
+ */
+template<typename TCB_Instance, std::uint_fast8_t... VECTOR_NUMBERS>
+class Profiler {
+  public:
+    static_assert( sizeof...( VECTOR_NUMBERS ) > 0 );
+
+    /**
+     * \brief The number of profiled interrupt vectors.
+     */
+    static constexpr auto VECTORS = std::uint_fast8_t{ sizeof...( VECTOR_NUMBERS ) };
+
+    /**
+     * \brief Interrupt handler duration measurement scope.
+     *
+     * \tparam VECTOR_NUMBER The number of the interrupt vector whose handler is being
+     *         measured.
+     *
+     * The duration is measured from the construction of the scope to its destruction.
+     */
+    template<std::uint_fast8_t VECTOR_NUMBER>
+    class Scope {
+      public:
+        /**
+         * \brief Constructor.
+         */
+        Scope() noexcept : m_entry{ timestamp() }
+        {
+        }
+
+        Scope( Scope && ) = delete;
+
+        Scope( Scope const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Scope() noexcept
+        {
+            record_duration<VECTOR_NUMBER>( timestamp() - m_entry );
+        }
+
+        auto operator=( Scope && ) = delete;
+
+        auto operator=( Scope const & ) = delete;
+
+      private:
+        /**
+         * \brief The entry timestamp.
+         */
+        std::uint16_t m_entry;
+    };
+
+    Profiler() = delete;
+
+    /**
+     * \brief Initialize the profiler's free-running counter and clear the profiler's
+     *        statistics.
+     */
+    static void initialize() noexcept
+    {
+        auto & tcb = TCB_Instance::instance();
+
+        tcb.ctrla   = 0;
+        tcb.ctrlb   = Peripheral::TCB::CTRLB::CNTMODE_INT;
+        tcb.intctrl = 0;
+        tcb.cnt     = 0;
+        tcb.ccmp    = std::numeric_limits<std::uint16_t>::max();
+        tcb.ctrla   = Peripheral::TCB::CTRLA::CLKSEL_CLKDIV1
+                    | Peripheral::TCB::CTRLA::Mask::ENABLE;
+
+        reset();
+    }
+
+    /**
+     * \brief Get the free-running counter's current value.
+     *
+     * \return The free-running counter's current value.
+     */
+    static auto timestamp() noexcept -> std::uint16_t
+    {
+        return TCB_Instance::instance().cnt;
+    }
+
+    /**
+     * \brief Record an interrupt handler duration.
+     *
+     * \tparam VECTOR_NUMBER The number of the interrupt vector whose handler duration is
+     *         being recorded.
+     *
+     * \param[in] cycles The interrupt handler duration.
+     *
+     * \attention This function must be called from the interrupt vector's handler.
+     */
+    template<std::uint_fast8_t VECTOR_NUMBER>
+    static void record_duration( std::uint16_t cycles ) noexcept
+    {
+        m_duration[ index<VECTOR_NUMBER>() ].update( cycles );
+    }
+
+    /**
+     * \brief Record an interrupt latency.
+     *
+     * \tparam VECTOR_NUMBER The number of the interrupt vector whose latency is being
+     *         recorded.
+     *
+     * \param[in] cycles The interrupt latency.
+     *
+     * \attention This function must be called from the interrupt vector's handler.
+     */
+    template<std::uint_fast8_t VECTOR_NUMBER>
+    static void record_latency( std::uint16_t cycles ) noexcept
+    {
+        m_latency[ index<VECTOR_NUMBER>() ].update( cycles );
+    }
+
+    /**
+     * \brief Get the number of a profiled interrupt vector.
+     *
+     * \pre i < picolibrary::Microchip::megaAVR0::Interrupt::Profiler::VECTORS
+     *
+     * \param[in] i The index of the profiled interrupt vector.
+     *
+     * \return The number of the profiled interrupt vector.
+     */
+    static auto vector_number( std::uint_fast8_t i ) noexcept -> std::uint_fast8_t
+    {
+        PICOLIBRARY_EXPECT( i < VECTORS, Generic_Error::OUT_OF_RANGE );
+
+        return PROFILED_VECTOR_NUMBERS[ i ];
+    }
+
+    /**
+     * \brief Get a profiled interrupt vector's handler duration statistics.
+     *
+     * \pre i < picolibrary::Microchip::megaAVR0::Interrupt::Profiler::VECTORS
+     *
+     * \param[in] i The index of the profiled interrupt vector.
+     *
+     * \return The profiled interrupt vector's handler duration statistics.
+     */
+    static auto duration( std::uint_fast8_t i ) noexcept -> Statistics
+    {
+        PICOLIBRARY_EXPECT( i < VECTORS, Generic_Error::OUT_OF_RANGE );
+
+        return snapshot( m_duration[ i ] );
+    }
+
+    /**
+     * \brief Get a profiled interrupt vector's latency statistics.
+     *
+     * \pre i < picolibrary::Microchip::megaAVR0::Interrupt::Profiler::VECTORS
+     *
+     * \param[in] i The index of the profiled interrupt vector.
+     *
+     * \return The profiled interrupt vector's latency statistics.
+     */
+    static auto latency( std::uint_fast8_t i ) noexcept -> Statistics
+    {
+        PICOLIBRARY_EXPECT( i < VECTORS, Generic_Error::OUT_OF_RANGE );
+
+        return snapshot( m_latency[ i ] );
+    }
+
+    /**
+     * \brief Clear the profiler's statistics.
+     */
+    static void reset() noexcept
+    {
+        Critical_Section const critical_section;
+
+        for ( auto i = std::uint_fast8_t{}; i < VECTORS; ++i ) {
+            m_duration[ i ] = Statistics{};
+            m_latency[ i ]  = Statistics{};
+        } // for
+    }
+
+  private:
+    /**
+     * \brief The numbers of the profiled interrupt vectors.
+     */
+    static constexpr std::uint_fast8_t PROFILED_VECTOR_NUMBERS[] = { VECTOR_NUMBERS... };
+
+    /**
+     * \brief The profiled interrupt vectors' handler duration statistics.
+     */
+    static inline Statistics m_duration[ VECTORS ]{};
+
+    /**
+     * \brief The profiled interrupt vectors' latency statistics.
+     */
+    static inline Statistics m_latency[ VECTORS ]{};
+
+    /**
+     * \brief Get the index of a profiled interrupt vector.
+     *
+     * \tparam VECTOR_NUMBER The number of the profiled interrupt vector.
+     *
+     * \return The index of the profiled interrupt vector.
+     */
+    template<std::uint_fast8_t VECTOR_NUMBER>
+    static constexpr auto index() noexcept -> std::uint_fast8_t
+    {
+        constexpr auto i = find( VECTOR_NUMBER );
+
+        static_assert( i < VECTORS, "interrupt vector is not profiled" );
+
+        return i;
+    }
+
+    /**
+     * \brief Find the index of an interrupt vector.
+     *
+     * \param[in] vector_number The number of the interrupt vector.
+     *
+     * \return The index of the interrupt vector if it is profiled.
+     * \return picolibrary::Microchip::megaAVR0::Interrupt::Profiler::VECTORS if the
+     *         interrupt vector is not profiled.
+     */
+    static constexpr auto find( std::uint_fast8_t vector_number ) noexcept
+        -> std::uint_fast8_t
+    {
+        for ( auto i = std::uint_fast8_t{}; i < VECTORS; ++i ) {
+            if ( PROFILED_VECTOR_NUMBERS[ i ] == vector_number ) {
+                return i;
+            } // if
+        }     // for
+
+        return VECTORS;
+    }
+
+    /**
+     * \brief Take a consistent snapshot of statistics that may be updated by an
+     *        interrupt handler.
+     *
+     * \param[in] statistics The statistics to take a snapshot of.
+     *
+     * \return The statistics snapshot.
+     */
+    static auto snapshot( Statistics const & statistics ) noexcept -> Statistics
+    {
+        Critical_Section const critical_section;
+
+        return statistics;
+    }
+};
+
+/**
+ * \brief Instrumented interrupt handler binding.
+ *
+ * \tparam Interrupt_Profiler The interrupt profiler
+ *         (picolibrary::Microchip::megaAVR0::Interrupt::Profiler) that records the
+ *         handler's duration.
+ * \tparam Interrupt_Binding The interrupt handler binding
+ *         (picolibrary::Microchip::megaAVR0::Interrupt::Binding or
+ *         picolibrary::Microchip::megaAVR0::Interrupt::Static_Binding) whose handler is
+ *         instrumented.
+ *
+ * An instrumented interrupt handler binding can be passed to
+ * PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND() in place of the binding it
+ * instruments.
+ */
+template<typename Interrupt_Profiler, typename Interrupt_Binding>
+class Instrumented_Binding {
+  public:
+    /**
+     * \brief The interrupt vector number.
+     */
+    static constexpr auto VECTOR_NUMBER = Interrupt_Binding::VECTOR_NUMBER;
+
+    Instrumented_Binding() = delete;
+
+    /**
+     * \brief Handle the interrupt.
+     */
+    static void handle() noexcept
+    {
+        typename Interrupt_Profiler::template Scope<VECTOR_NUMBER> const scope{};
+
+        Interrupt_Binding::handle();
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0::Interrupt
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_INSTRUMENTATION_H
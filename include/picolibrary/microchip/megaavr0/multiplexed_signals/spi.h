@@ -31,6 +31,7 @@
 #include "picolibrary/microchip/megaavr0/peripheral/portmux.h"
 #include "picolibrary/microchip/megaavr0/peripheral/spi.h"
 #include "picolibrary/microchip/megaavr0/peripheral/vport.h"
+#include "picolibrary/peripheral.h"
 #include "picolibrary/precondition.h"
 #include "picolibrary/utility.h"
 
@@ -878,6 +879,86 @@ inline auto miso_mask( Peripheral::SPI const & spi ) noexcept -> std::uint8_t
     return miso_mask( spi, spi_route( spi ) );
 }
 
+/**
+ * \brief Compile-time SPI peripheral signal lookup.
+ *
+ * Invalid SPI peripheral routing configurations are rejected at compile time.
+ *
+ * \tparam SPI_Instance The SPI peripheral instance whose signals are to be looked up.
+ * \tparam SPI_ROUTE The SPI peripheral's routing configuration.
+ */
+template<typename SPI_Instance, SPI_Route SPI_ROUTE>
+class SPI_Signals {
+  public:
+    /**
+     * \brief The SPI peripheral instance.
+     */
+    using Instance = SPI_Instance;
+
+    /**
+     * \brief The SPI peripheral's routing configuration.
+     */
+    static constexpr auto ROUTE = SPI_ROUTE;
+
+    /**
+     * \brief The SPI peripheral's pins PORT peripheral instance.
+     */
+    using PORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::PORT, spi_port_address( SPI_Instance::ADDRESS, SPI_ROUTE )>;
+
+    /**
+     * \brief The SPI peripheral's pins VPORT peripheral instance.
+     */
+    using VPORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::VPORT, spi_vport_address( SPI_Instance::ADDRESS, SPI_ROUTE )>;
+
+    /**
+     * \brief The SPI peripheral's SS pin number.
+     */
+    static constexpr auto SS_NUMBER = ss_number( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief The SPI peripheral's SS pin mask.
+     */
+    static constexpr auto SS_MASK = ss_mask( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief The SPI peripheral's SCK pin number.
+     */
+    static constexpr auto SCK_NUMBER = sck_number( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief The SPI peripheral's SCK pin mask.
+     */
+    static constexpr auto SCK_MASK = sck_mask( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief The SPI peripheral's MOSI pin number.
+     */
+    static constexpr auto MOSI_NUMBER = mosi_number( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief The SPI peripheral's MOSI pin mask.
+     */
+    static constexpr auto MOSI_MASK = mosi_mask( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief The SPI peripheral's MISO pin number.
+     */
+    static constexpr auto MISO_NUMBER = miso_number( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief The SPI peripheral's MISO pin mask.
+     */
+    static constexpr auto MISO_MASK = miso_mask( SPI_Instance::ADDRESS, SPI_ROUTE );
+
+    /**
+     * \brief Set the SPI peripheral's routing configuration.
+     */
+    static void set_route() noexcept
+    {
+        set_spi_route( SPI_Instance::instance(), SPI_ROUTE );
+    }
+};
+
 } // namespace picolibrary::Microchip::megaAVR0::Multiplexed_Signals
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_MULTIPLEXED_SIGNALS_SPI_H
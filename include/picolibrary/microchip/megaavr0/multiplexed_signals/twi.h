@@ -31,6 +31,7 @@
 #include "picolibrary/microchip/megaavr0/peripheral/portmux.h"
 #include "picolibrary/microchip/megaavr0/peripheral/twi.h"
 #include "picolibrary/microchip/megaavr0/peripheral/vport.h"
+#include "picolibrary/peripheral.h"
 #include "picolibrary/precondition.h"
 #include "picolibrary/utility.h"
 
@@ -1136,6 +1137,76 @@ inline auto device_sda_mask( Peripheral::TWI const & twi ) noexcept -> std::uint
     return sda_mask( twi );
 }
 
+/**
+ * \brief Compile-time TWI peripheral signal lookup.
+ *
+ * The PORT and VPORT peripheral instances are resolved at compile time.
+ *
+ * \tparam TWI_Instance The TWI peripheral instance whose signals are to be looked up.
+ * \tparam TWI_ROUTE The TWI peripheral's routing configuration.
+ */
+template<typename TWI_Instance, TWI_Route TWI_ROUTE>
+class TWI_Signals {
+  public:
+    /**
+     * \brief The TWI peripheral instance.
+     */
+    using Instance = TWI_Instance;
+
+    /**
+     * \brief The TWI peripheral's routing configuration.
+     */
+    static constexpr auto ROUTE = TWI_ROUTE;
+
+    /**
+     * \brief The TWI peripheral's controller pins PORT peripheral instance.
+     */
+    using Controller_PORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::PORT, twi_controller_port_address( TWI_Instance::ADDRESS, TWI_ROUTE )>;
+
+    /**
+     * \brief The TWI peripheral's controller pins VPORT peripheral instance.
+     */
+    using Controller_VPORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::VPORT, twi_controller_vport_address( TWI_Instance::ADDRESS, TWI_ROUTE )>;
+
+    /**
+     * \brief The TWI peripheral's device pins PORT peripheral instance.
+     */
+    using Device_PORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::PORT, twi_device_port_address( TWI_Instance::ADDRESS, TWI_ROUTE )>;
+
+    /**
+     * \brief The TWI peripheral's device pins VPORT peripheral instance.
+     */
+    using Device_VPORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::VPORT, twi_device_vport_address( TWI_Instance::ADDRESS, TWI_ROUTE )>;
+
+    /**
+     * \brief The TWI peripheral's SCL pin number.
+     */
+    static constexpr auto SCL_NUMBER = scl_number( TWI_Instance::ADDRESS, TWI_ROUTE );
+
+    /**
+     * \brief The TWI peripheral's SCL pin mask.
+     */
+    static constexpr auto SCL_MASK = scl_mask( TWI_Instance::ADDRESS, TWI_ROUTE );
+
+    /**
+     * \brief The TWI peripheral's SDA pin number.
+     */
+    static constexpr auto SDA_NUMBER = sda_number( TWI_Instance::ADDRESS, TWI_ROUTE );
+
+    /**
+     * \brief The TWI peripheral's SDA pin mask.
+     */
+    static constexpr auto SDA_MASK = sda_mask( TWI_Instance::ADDRESS, TWI_ROUTE );
+
+    /**
+     * \brief Set the TWI peripheral's routing configuration.
+     */
+    static void set_route() noexcept
+    {
+        set_twi_route( TWI_Instance::instance(), TWI_ROUTE );
+    }
+};
+
 } // namespace picolibrary::Microchip::megaAVR0::Multiplexed_Signals
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_MULTIPLEXED_SIGNALS_TWI_H
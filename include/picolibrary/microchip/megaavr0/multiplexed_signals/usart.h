@@ -31,6 +31,7 @@
 #include "picolibrary/microchip/megaavr0/peripheral/portmux.h"
 #include "picolibrary/microchip/megaavr0/peripheral/usart.h"
 #include "picolibrary/microchip/megaavr0/peripheral/vport.h"
+#include "picolibrary/peripheral.h"
 #include "picolibrary/precondition.h"
 #include "picolibrary/utility.h"
 
@@ -1074,6 +1075,87 @@ inline auto rxd_mask( Peripheral::USART const & usart ) noexcept -> std::uint8_t
     return rxd_mask( usart, usart_route( usart ) );
 }
 
+/**
+ * \brief Compile-time USART peripheral signal lookup.
+ *
+ * The pin masks and numbers are compile-time constants.
+ *
+ * \tparam USART_Instance The USART peripheral instance whose signals are to be looked
+ *         up.
+ * \tparam USART_ROUTE The USART peripheral's routing configuration.
+ */
+template<typename USART_Instance, USART_Route USART_ROUTE>
+class USART_Signals {
+  public:
+    /**
+     * \brief The USART peripheral instance.
+     */
+    using Instance = USART_Instance;
+
+    /**
+     * \brief The USART peripheral's routing configuration.
+     */
+    static constexpr auto ROUTE = USART_ROUTE;
+
+    /**
+     * \brief The USART peripheral's pins PORT peripheral instance.
+     */
+    using PORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::PORT, usart_port_address( USART_Instance::ADDRESS, USART_ROUTE )>;
+
+    /**
+     * \brief The USART peripheral's pins VPORT peripheral instance.
+     */
+    using VPORT_Instance = ::picolibrary::Peripheral::Instance<Peripheral::VPORT, usart_vport_address( USART_Instance::ADDRESS, USART_ROUTE )>;
+
+    /**
+     * \brief The USART peripheral's XCK pin number.
+     */
+    static constexpr auto XCK_NUMBER = xck_number( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief The USART peripheral's XCK pin mask.
+     */
+    static constexpr auto XCK_MASK = xck_mask( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief The USART peripheral's XDIR pin number.
+     */
+    static constexpr auto XDIR_NUMBER = xdir_number( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief The USART peripheral's XDIR pin mask.
+     */
+    static constexpr auto XDIR_MASK = xdir_mask( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief The USART peripheral's TXD pin number.
+     */
+    static constexpr auto TXD_NUMBER = txd_number( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief The USART peripheral's TXD pin mask.
+     */
+    static constexpr auto TXD_MASK = txd_mask( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief The USART peripheral's RXD pin number.
+     */
+    static constexpr auto RXD_NUMBER = rxd_number( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief The USART peripheral's RXD pin mask.
+     */
+    static constexpr auto RXD_MASK = rxd_mask( USART_Instance::ADDRESS, USART_ROUTE );
+
+    /**
+     * \brief Set the USART peripheral's routing configuration.
+     */
+    static void set_route() noexcept
+    {
+        set_usart_route( USART_Instance::instance(), USART_ROUTE );
+    }
+};
+
 } // namespace picolibrary::Microchip::megaAVR0::Multiplexed_Signals
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_MULTIPLEXED_SIGNALS_USART_H
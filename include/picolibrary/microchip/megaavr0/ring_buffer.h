@@ -0,0 +1,340 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Ring_Buffer interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR0_RING_BUFFER_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR0_RING_BUFFER_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::megaAVR0 {
+
+/**
+ * \brief Single-producer, single-consumer ring buffer.
+ *
+ * \tparam T The ring buffer element type.
+ * \tparam N The ring buffer capacity (must be a power of two between 2 and 128).
+ *
+ * The producer (e.g. an interrupt handler) and the consumer (e.g. the main loop) can
+ * access the ring buffer concurrently without critical sections. Each index is a single
+ * byte that is only written by one side, so index updates are atomic, and elements are
+ * written/read before the index that makes them visible to the other side is updated.
+ * The indices are free-running, so all N elements can be used.
+ *
+ * \attention Only a single producer and a single consumer are supported. If the ring
+ *            buffer is written to (or read from) by both an interrupt handler and the
+ *            main loop, the main loop must prevent the interrupt handler from executing
+ *            while it accesses the ring buffer.
+ */
+template<typename T, std::uint_fast8_t N>
+class Ring_Buffer {
+  public:
+    static_assert( N >= 2 and N <= 128, "N must be between 2 and 128" );
+    static_assert( not( N & ( N - 1 ) ), "N must be a power of two" );
+
+    /**
+     * \brief The ring buffer element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The unsigned integral type used to represent ring buffer sizes.
+     */
+    using Size = std::uint_fast8_t;
+
+    /**
+     * \brief The ring buffer element pointer type.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief The ring buffer element const pointer type.
+     */
+    using Const_Pointer = Value const *;
+
+    /**
+     * \brief The ring buffer capacity.
+     */
+    static constexpr auto CAPACITY = Size{ N };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Ring_Buffer() noexcept = default;
+
+    Ring_Buffer( Ring_Buffer && ) = delete;
+
+    Ring_Buffer( Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Ring_Buffer() noexcept = default;
+
+    auto operator=( Ring_Buffer && ) = delete;
+
+    auto operator=( Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Check if the ring buffer is empty.
+     *
+     * \return true if the ring buffer is empty.
+     * \return false if the ring buffer is not empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return m_write_index == m_read_index;
+    }
+
+    /**
+     * \brief Check if the ring buffer is full.
+     *
+     * \return true if the ring buffer is full.
+     * \return false if the ring buffer is not full.
+     */
+    auto full() const noexcept -> bool
+    {
+        return size() == CAPACITY;
+    }
+
+    /**
+     * \brief Get the number of elements in the ring buffer.
+     *
+     * \return The number of elements in the ring buffer.
+     */
+    auto size() const noexcept -> Size
+    {
+        return static_cast<std::uint8_t>( m_write_index - m_read_index );
+    }
+
+    /**
+     * \brief Write an element to the ring buffer (producer).
+     *
+     * \pre not full()
+     *
+     * \param[in] value The element to write to the ring buffer.
+     */
+    void push( Value const & value ) noexcept
+    {
+        std::uint8_t const write_index = m_write_index;
+
+        PICOLIBRARY_EXPECT(
+            static_cast<std::uint8_t>( write_index - m_read_index ) < CAPACITY,
+            Generic_Error::INSUFFICIENT_CAPACITY );
+
+        m_storage[ write_index & INDEX_MASK ] = value;
+
+        publish();
+
+        m_write_index = write_index + 1;
+    }
+
+    /**
+     * \brief Get a pointer to the beginning of the contiguous free space in the ring
+     *        buffer (producer).
+     *
+     * \return A pointer to the beginning of the contiguous free space in the ring buffer.
+     */
+    auto write_begin() noexcept -> Pointer
+    {
+        return &m_storage[ m_write_index & INDEX_MASK ];
+    }
+
+    /**
+     * \brief Get a pointer to the end of the contiguous free space in the ring buffer
+     *        (producer).
+     *
+     * \return A pointer to the end of the contiguous free space in the ring buffer.
+     *
+     * \attention Since the consumer may concurrently free space, the contiguous free
+     *            space may grow, but never shrink, between calls to this function.
+     */
+    auto write_end() noexcept -> Pointer
+    {
+        std::uint8_t const write_index = m_write_index;
+        auto const         available   = static_cast<std::uint8_t>(
+            CAPACITY - static_cast<std::uint8_t>( write_index - m_read_index ) );
+
+        return &m_storage[ write_index & INDEX_MASK ]
+               + contiguous( write_index, available );
+    }
+
+    /**
+     * \brief Make elements written to the contiguous free space in the ring buffer
+     *        available to the consumer (producer).
+     *
+     * \pre n <= write_end() - write_begin()
+     *
+     * \param[in] n The number of elements written to the contiguous free space in the
+     *            ring buffer.
+     */
+    void commit_write( Size n ) noexcept
+    {
+        std::uint8_t const write_index = m_write_index;
+
+        PICOLIBRARY_EXPECT(
+            n <= CAPACITY - static_cast<std::uint8_t>( write_index - m_read_index ),
+            Generic_Error::INSUFFICIENT_CAPACITY );
+
+        publish();
+
+        m_write_index = write_index + n;
+    }
+
+    /**
+     * \brief Get the oldest element in the ring buffer (consumer).
+     *
+     * \pre not empty()
+     *
+     * \return The oldest element in the ring buffer.
+     */
+    auto front() const noexcept -> Value const &
+    {
+        std::uint8_t const read_index = m_read_index;
+
+        PICOLIBRARY_EXPECT( m_write_index != read_index, Generic_Error::WOULD_UNDERFLOW );
+
+        publish();
+
+        return m_storage[ read_index & INDEX_MASK ];
+    }
+
+    /**
+     * \brief Remove the oldest element from the ring buffer (consumer).
+     *
+     * \pre not empty()
+     */
+    void pop() noexcept
+    {
+        std::uint8_t const read_index = m_read_index;
+
+        PICOLIBRARY_EXPECT( m_write_index != read_index, Generic_Error::WOULD_UNDERFLOW );
+
+        publish();
+
+        m_read_index = read_index + 1;
+    }
+
+    /**
+     * \brief Get a pointer to the beginning of the contiguous elements in the ring buffer
+     *        (consumer).
+     *
+     * \return A pointer to the beginning of the contiguous elements in the ring buffer.
+     */
+    auto read_begin() const noexcept -> Const_Pointer
+    {
+        return &m_storage[ m_read_index & INDEX_MASK ];
+    }
+
+    /**
+     * \brief Get a pointer to the end of the contiguous elements in the ring buffer
+     *        (consumer).
+     *
+     * \return A pointer to the end of the contiguous elements in the ring buffer.
+     *
+     * \attention Since the producer may concurrently write elements, the contiguous
+     *            elements may grow, but never shrink, between calls to this function.
+     */
+    auto read_end() const noexcept -> Const_Pointer
+    {
+        std::uint8_t const read_index = m_read_index;
+        auto const         elements   = static_cast<std::uint8_t>(
+            m_write_index - read_index );
+
+        publish();
+
+        return &m_storage[ read_index & INDEX_MASK ] + contiguous( read_index, elements );
+    }
+
+    /**
+     * \brief Remove elements from the contiguous elements in the ring buffer (consumer).
+     *
+     * \pre n <= read_end() - read_begin()
+     *
+     * \param[in] n The number of elements to remove from the contiguous elements in the
+     *            ring buffer.
+     */
+    void commit_read( Size n ) noexcept
+    {
+        std::uint8_t const read_index = m_read_index;
+
+        PICOLIBRARY_EXPECT(
+            n <= static_cast<std::uint8_t>( m_write_index - read_index ),
+            Generic_Error::WOULD_UNDERFLOW );
+
+        publish();
+
+        m_read_index = read_index + n;
+    }
+
+  private:
+    /**
+     * \brief The storage index mask.
+     */
+    static constexpr auto INDEX_MASK = std::uint8_t{ N - 1 };
+
+    /**
+     * \brief The ring buffer storage.
+     */
+    Value m_storage[ N ]{};
+
+    /**
+     * \brief The free-running write index (only written by the producer).
+     */
+    std::uint8_t volatile m_write_index{};
+
+    /**
+     * \brief The free-running read index (only written by the consumer).
+     */
+    std::uint8_t volatile m_read_index{};
+
+    /**
+     * \brief Prevent the compiler from reordering element accesses across index
+     *        accesses.
+     */
+    static void publish() noexcept
+    {
+        asm volatile( "" ::: "memory" );
+    }
+
+    /**
+     * \brief Get the number of contiguous storage elements starting at an index.
+     *
+     * \param[in] index The free-running index.
+     * \param[in] n The number of elements (possibly wrapping) starting at the index.
+     *
+     * \return The number of contiguous storage elements starting at the index.
+     */
+    static constexpr auto contiguous( std::uint8_t index, std::uint8_t n ) noexcept
+        -> Size
+    {
+        auto const until_wrap = static_cast<std::uint8_t>( N - ( index & INDEX_MASK ) );
+
+        return n < until_wrap ? n : until_wrap;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR0
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR0_RING_BUFFER_H
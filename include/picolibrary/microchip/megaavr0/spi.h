@@ -200,6 +200,35 @@ class Fixed_Configuration_Basic_Controller<Peripheral::SPI> {
         configure_controller( spi_clock_rate, spi_clock_polarity, spi_clock_phase, spi_bit_order );
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \tparam SPI_Instance The SPI peripheral instance to be used by the controller.
+     * \tparam SPI_ROUTE The desired SPI peripheral routing configuration.
+     *
+     * \param[in] spi_clock_rate The desired SPI clock rate.
+     * \param[in] spi_clock_polarity The desired SPI clock polarity.
+     * \param[in] spi_clock_phase The desired SPI clock phase.
+     * \param[in] spi_bit_order The desired SPI bit order.
+     */
+    template<typename SPI_Instance, Multiplexed_Signals::SPI_Route SPI_ROUTE>
+    Fixed_Configuration_Basic_Controller(
+        Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>,
+        SPI_Clock_Rate     spi_clock_rate,
+        SPI_Clock_Polarity spi_clock_polarity,
+        SPI_Clock_Phase    spi_clock_phase,
+        SPI_Bit_Order      spi_bit_order ) noexcept :
+        m_spi{ &SPI_Instance::instance() },
+        m_spi_sck_mosi{ Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::PORT_Instance::instance(),
+                        static_cast<std::uint8_t>(
+                            Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::SCK_MASK
+                            | Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::MOSI_MASK ) }
+    {
+        Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::set_route();
+
+        configure_controller( spi_clock_rate, spi_clock_polarity, spi_clock_phase, spi_bit_order );
+    }
+
     /**
      * \brief Constructor.
      *
@@ -454,6 +483,38 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
             usart_clock_generator_scaling_factor, usart_clock_polarity, usart_clock_phase, usart_bit_order );
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \tparam USART_Instance The USART peripheral instance to be used by the controller.
+     * \tparam USART_ROUTE The desired USART peripheral routing configuration.
+     *
+     * \param[in] usart_clock_generator_scaling_factor The desired USART clock generator
+     *            scaling factor (BAUD register value).
+     * \param[in] usart_clock_polarity The desired USART clock polarity.
+     * \param[in] usart_clock_phase The desired USART clock phase.
+     * \param[in] usart_bit_order The desired USART bit order.
+     */
+    template<typename USART_Instance, Multiplexed_Signals::USART_Route USART_ROUTE>
+    Fixed_Configuration_Basic_Controller(
+        Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>,
+        std::uint16_t        usart_clock_generator_scaling_factor,
+        USART_Clock_Polarity usart_clock_polarity,
+        USART_Clock_Phase    usart_clock_phase,
+        USART_Bit_Order      usart_bit_order ) noexcept :
+        m_usart{ &USART_Instance::instance() },
+        m_usart_xck_txd_port{ &Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::PORT_Instance::instance() },
+        m_usart_xck_txd_mask{ static_cast<std::uint8_t>(
+            Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::XCK_MASK
+            | Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::TXD_MASK ) },
+        m_usart_xck_number{ Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::XCK_NUMBER }
+    {
+        Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::set_route();
+
+        configure_controller(
+            usart_clock_generator_scaling_factor, usart_clock_polarity, usart_clock_phase, usart_bit_order );
+    }
+
     /**
      * \brief Constructor.
      *
@@ -845,6 +906,24 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
         Multiplexed_Signals::set_spi_route( spi, spi_route );
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \tparam SPI_Instance The SPI peripheral instance to be used by the controller.
+     * \tparam SPI_ROUTE The desired SPI peripheral routing configuration.
+     */
+    template<typename SPI_Instance, Multiplexed_Signals::SPI_Route SPI_ROUTE>
+    Variable_Configuration_Basic_Controller( Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE> ) noexcept
+        :
+        m_spi{ &SPI_Instance::instance() },
+        m_spi_sck_mosi{ Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::PORT_Instance::instance(),
+                        static_cast<std::uint8_t>(
+                            Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::SCK_MASK
+                            | Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::MOSI_MASK ) }
+    {
+        Multiplexed_Signals::SPI_Signals<SPI_Instance, SPI_ROUTE>::set_route();
+    }
+
     /**
      * \brief Constructor.
      *
@@ -1183,6 +1262,25 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
         Multiplexed_Signals::set_usart_route( usart, usart_route );
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \tparam USART_Instance The USART peripheral instance to be used by the controller.
+     * \tparam USART_ROUTE The desired USART peripheral routing configuration.
+     */
+    template<typename USART_Instance, Multiplexed_Signals::USART_Route USART_ROUTE>
+    Variable_Configuration_Basic_Controller( Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE> ) noexcept
+        :
+        m_usart{ &USART_Instance::instance() },
+        m_usart_xck_txd_port{ &Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::PORT_Instance::instance() },
+        m_usart_xck_txd_mask{ static_cast<std::uint8_t>(
+            Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::XCK_MASK
+            | Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::TXD_MASK ) },
+        m_usart_xck_number{ Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::XCK_NUMBER }
+    {
+        Multiplexed_Signals::USART_Signals<USART_Instance, USART_ROUTE>::set_route();
+    }
+
     /**
      * \brief Constructor.
      *
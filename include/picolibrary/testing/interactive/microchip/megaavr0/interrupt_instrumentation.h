@@ -0,0 +1,99 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Interactive::Microchip::megaAVR0::Interrupt
+ *        instrumentation interface.
+ */
+
+#ifndef PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_INTERRUPT_INSTRUMENTATION_H
+#define PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_INTERRUPT_INSTRUMENTATION_H
+
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/interrupt_instrumentation.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/stream.h"
+
+/**
+ * \brief Microchip megaAVR 0-series interrupt interactive testing facilities.
+ */
+namespace picolibrary::Testing::Interactive::Microchip::megaAVR0::Interrupt {
+
+/**
+ * \brief Print interrupt timing statistics.
+ *
+ * \param[in] stream The output stream to write the interrupt timing statistics to.
+ * \param[in] statistics The interrupt timing statistics to write to the stream.
+ */
+inline void print(
+    Reliable_Output_Stream &                                           stream,
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Statistics const & statistics ) noexcept
+{
+    if ( not statistics.count() ) {
+        stream.print( PICOLIBRARY_ROM_STRING( "-" ) );
+
+        return;
+    } // if
+
+    stream.print(
+        Format::Decimal{ statistics.minimum() },
+        '/',
+        Format::Decimal{ statistics.total() / statistics.count() },
+        '/',
+        Format::Decimal{ statistics.maximum() } );
+}
+
+/**
+ * \brief Print interrupt profiler statistics interactive test helper.
+ *
+ * \tparam Profiler The interrupt profiler
+ *         (picolibrary::Microchip::megaAVR0::Interrupt::Profiler) whose statistics are to
+ *         be written to the stream.
+ *
+ * \param[in] stream The output stream to write the interrupt profiler statistics to.
+ *
+ * Each profiled interrupt vector's number, number of handler executions, handler duration
+ * (minimum/average/maximum CLK_PER cycles), and latency (minimum/average/maximum CLK_PER
+ * cycles) are written to the stream.
+ */
+template<typename Profiler>
+void print( Reliable_Output_Stream & stream ) noexcept
+{
+    for ( auto i = std::uint_fast8_t{}; i < Profiler::VECTORS; ++i ) {
+        auto const duration = Profiler::duration( i );
+
+        stream.print(
+            PICOLIBRARY_ROM_STRING( "vector " ),
+            Format::Decimal{ static_cast<std::uint8_t>( Profiler::vector_number( i ) ) },
+            PICOLIBRARY_ROM_STRING( ": count " ),
+            Format::Decimal{ duration.count() },
+            PICOLIBRARY_ROM_STRING( ", duration " ) );
+        print( stream, duration );
+        stream.print( PICOLIBRARY_ROM_STRING( ", latency " ) );
+        print( stream, Profiler::latency( i ) );
+        stream.print( '\n' );
+    } // for
+
+    stream.flush();
+}
+
+} // namespace picolibrary::Testing::Interactive::Microchip::megaAVR0::Interrupt
+
+#endif // PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_INTERRUPT_INSTRUMENTATION_H
@@ -0,0 +1,186 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::ADC::Block_Sampler capture interactive test
+ *        program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/adc.h"
+#include "picolibrary/microchip/megaavr0/clock_plan.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+#include "picolibrary/utility.h"
+
+namespace {
+
+using ::picolibrary::to_underlying;
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Clock_Prescaler;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Input;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Reference;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Resolution;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Sampling_Capacitance;
+using ::picolibrary::Microchip::megaAVR0::ADC::Block_Sampler;
+using ::picolibrary::Microchip::megaAVR0::ADC::route_conversion_trigger;
+using ::picolibrary::Microchip::megaAVR0::ADC::Sample;
+using ::picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Frequency;
+using ::picolibrary::Microchip::megaAVR0::Clock::Plan;
+using ::picolibrary::Microchip::megaAVR0::Clock::Prescaler;
+using ::picolibrary::Microchip::megaAVR0::Clock::Prescaler_Value;
+using ::picolibrary::Microchip::megaAVR0::Clock::TCA_Clock_Prescaler;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Binding;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Controller;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Source;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The clock plan.
+ */
+using Clock_Plan = Plan<
+    ::picolibrary::Microchip::megaAVR0::Clock::Source::INTERNAL_16_20_MHz_OSCILLATOR,
+    Internal_16_20_MHz_Oscillator_Frequency::INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY,
+    Prescaler_Value::PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_CONFIGURE_CLOCK_CLOCK_PRESCALER_VALUE,
+    Prescaler::PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_CONFIGURE_CLOCK_CLOCK_PRESCALER_CONFIGURATION>;
+
+/**
+ * \brief The sample block size.
+ */
+constexpr auto BLOCK_SIZE = std::uint_fast8_t{ 64 };
+
+/**
+ * \brief The TCA clock prescaler.
+ */
+constexpr auto TCA_CLOCK_PRESCALER = TCA_Clock_Prescaler::_1;
+
+/**
+ * \brief The TCA period (PER register value).
+ */
+constexpr auto TCA_PERIOD = Clock_Plan::tca_period<SAMPLER_SAMPLE_RATE, TCA_CLOCK_PRESCALER>();
+
+/**
+ * \brief The number of peripheral clock cycles each conversion leaves idle before the
+ *        next trigger.
+ */
+constexpr auto SAMPLING_SLACK = Clock_Plan::adc_sampling_slack<SAMPLER_SAMPLE_RATE, ADC_Clock_Prescaler::SAMPLER_ADC_CLOCK_PRESCALER, ADC_Resolution::SAMPLER_ADC_RESOLUTION>();
+
+/**
+ * \brief The block sampler.
+ */
+Block_Sampler<BLOCK_SIZE> sampler{ SAMPLER_ADC::instance(),
+                                   ADC_Reference::SAMPLER_ADC_REFERENCE,
+                                   ADC_Sampling_Capacitance::SAMPLER_ADC_SAMPLING_CAPACITANCE,
+                                   ADC_Clock_Prescaler::SAMPLER_ADC_CLOCK_PRESCALER,
+                                   ADC_Resolution::SAMPLER_ADC_RESOLUTION };
+
+/**
+ * \brief Configure the TCA to overflow at the sample rate.
+ */
+void configure_tca() noexcept
+{
+    auto & tca = SAMPLER_TCA::instance().normal;
+
+    tca.ctrla   = 0;
+    tca.ctrlb   = TCA::Normal::CTRLB::WGMODE_NORMAL;
+    tca.intctrl = 0;
+    tca.cnt     = 0;
+    tca.per     = TCA_PERIOD;
+    tca.ctrla   = to_underlying( TCA_CLOCK_PRESCALER ) | TCA::Normal::CTRLA::Mask::ENABLE;
+}
+
+} // namespace
+
+/**
+ * \brief Sampler ADC RESRDY interrupt handler.
+ */
+PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND(
+    SAMPLER_ADC_RESRDY_INTERRUPT_VECTOR,
+    Binding<SAMPLER_ADC, Source::RESRDY, sampler, &Block_Sampler<BLOCK_SIZE>::handle_result_ready> )
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::ADC::Block_Sampler capture
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    Log::instance().print(
+        PICOLIBRARY_ROM_STRING( "sample period: " ),
+        Decimal{ Clock_Plan::CLK_PER_FREQUENCY / SAMPLER_SAMPLE_RATE },
+        PICOLIBRARY_ROM_STRING( " CLK_PER cycles, slack: " ),
+        Decimal{ SAMPLING_SLACK },
+        PICOLIBRARY_ROM_STRING( " CLK_PER cycles\n" ) );
+    Log::instance().flush();
+
+    sampler.initialize();
+    sampler.select_input( ADC_Input::SAMPLER_ADC_INPUT );
+
+    route_conversion_trigger( EVSYS::SAMPLER_EVSYS_CHANNEL, EVSYS::CHANNEL::GENERATOR_TCA0_OVF_LUNF );
+
+    Controller{}.enable_interrupt();
+
+    sampler.start_event_triggered();
+
+    configure_tca();
+
+    for ( ;; ) {
+        if ( not sampler.block_available() ) {
+            continue;
+        } // if
+
+        auto minimum = Sample{ 0xFFFF };
+        auto maximum = Sample{};
+        auto sum     = std::uint32_t{};
+
+        for ( auto const sample : sampler.block() ) {
+            minimum = sample < minimum ? sample : minimum;
+            maximum = sample > maximum ? sample : maximum;
+            sum += sample;
+        } // for
+
+        sampler.release_block();
+
+        auto const overrun = sampler.overrun();
+
+        sampler.clear_overrun();
+
+        Log::instance().print(
+            PICOLIBRARY_ROM_STRING( "min: " ),
+            Decimal{ minimum },
+            PICOLIBRARY_ROM_STRING( ", max: " ),
+            Decimal{ maximum },
+            PICOLIBRARY_ROM_STRING( ", mean: " ),
+            Decimal{ static_cast<Sample>( sum / BLOCK_SIZE ) },
+            overrun ? PICOLIBRARY_ROM_STRING( ", overrun\n" ) : PICOLIBRARY_ROM_STRING( "\n" ) );
+        Log::instance().flush();
+    } // for
+}
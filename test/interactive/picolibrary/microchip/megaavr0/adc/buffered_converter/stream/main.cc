@@ -0,0 +1,147 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::ADC::Buffered_Converter stream interactive test
+ *        program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/adc.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::ADC::accumulated_conversions;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Accumulation;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Clock_Prescaler;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Input;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Reference;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Resolution;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Sampling_Capacitance;
+using ::picolibrary::Microchip::megaAVR0::ADC::Buffered_Converter;
+using ::picolibrary::Microchip::megaAVR0::ADC::effective_resolution;
+using ::picolibrary::Microchip::megaAVR0::ADC::Sample;
+using ::picolibrary::Microchip::megaAVR0::ADC::scale;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Binding;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Controller;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Source;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The converter ADC accumulation.
+ */
+constexpr auto ACCUMULATION = ADC_Accumulation::CONVERTER_ADC_ACCUMULATION;
+
+/**
+ * \brief The number of samples summarized by each report.
+ */
+constexpr auto REPORT_SAMPLES = std::uint16_t{ 4096 };
+
+/**
+ * \brief The buffered converter.
+ */
+Buffered_Converter<32> converter{ CONVERTER_ADC::instance(),
+                                  ADC_Reference::CONVERTER_ADC_REFERENCE,
+                                  ADC_Sampling_Capacitance::CONVERTER_ADC_SAMPLING_CAPACITANCE,
+                                  ADC_Clock_Prescaler::CONVERTER_ADC_CLOCK_PRESCALER,
+                                  ADC_Resolution::CONVERTER_ADC_RESOLUTION };
+
+} // namespace
+
+/**
+ * \brief Converter ADC RESRDY interrupt handler.
+ */
+PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND(
+    CONVERTER_ADC_RESRDY_INTERRUPT_VECTOR,
+    Binding<CONVERTER_ADC, Source::RESRDY, converter, &Buffered_Converter<32>::handle_result_ready> )
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::ADC::Buffered_Converter stream
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    converter.initialize();
+    converter.select_input( ADC_Input::CONVERTER_ADC_INPUT );
+    converter.configure_accumulation( ACCUMULATION );
+
+    Log::instance().print(
+        PICOLIBRARY_ROM_STRING( "accumulated conversions: " ),
+        Decimal{ accumulated_conversions( ACCUMULATION ) },
+        PICOLIBRARY_ROM_STRING( ", effective resolution: " ),
+        Decimal{ effective_resolution( ADC_Resolution::CONVERTER_ADC_RESOLUTION, ACCUMULATION ) },
+        PICOLIBRARY_ROM_STRING( " bits\n" ) );
+    Log::instance().flush();
+
+    Controller{}.enable_interrupt();
+
+    converter.start_free_running();
+
+    auto samples = std::uint16_t{};
+    auto minimum = Sample{ 0xFFFF };
+    auto maximum = Sample{};
+    auto sum     = std::uint32_t{};
+
+    for ( ;; ) {
+        if ( not converter.sample_available() ) {
+            continue;
+        } // if
+
+        auto const sample = scale( converter.sample(), ACCUMULATION );
+
+        minimum = sample < minimum ? sample : minimum;
+        maximum = sample > maximum ? sample : maximum;
+        sum += sample;
+
+        if ( ++samples == REPORT_SAMPLES ) {
+            Log::instance().print(
+                PICOLIBRARY_ROM_STRING( "min: " ),
+                Decimal{ minimum },
+                PICOLIBRARY_ROM_STRING( ", max: " ),
+                Decimal{ maximum },
+                PICOLIBRARY_ROM_STRING( ", mean: " ),
+                Decimal{ static_cast<Sample>( sum / REPORT_SAMPLES ) },
+                PICOLIBRARY_ROM_STRING( ", overruns: " ),
+                Decimal{ converter.overruns() },
+                PICOLIBRARY_ROM_STRING( "\n" ) );
+            Log::instance().flush();
+
+            samples = 0;
+            minimum = Sample{ 0xFFFF };
+            maximum = Sample{};
+            sum     = 0;
+        } // if
+    }     // for
+}
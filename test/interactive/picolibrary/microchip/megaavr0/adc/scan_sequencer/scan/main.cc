@@ -0,0 +1,116 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::ADC::Scan_Sequencer scan interactive test
+ *        program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/adc.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Clock_Prescaler;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Input;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Reference;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Resolution;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Sampling_Capacitance;
+using ::picolibrary::Microchip::megaAVR0::ADC::Scan_Channel;
+using ::picolibrary::Microchip::megaAVR0::ADC::Scan_Sequencer;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Binding;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Controller;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Source;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The scan sequencer.
+ */
+using Sequencer = Scan_Sequencer<
+    Scan_Channel<ADC_Input::SEQUENCER_ADC_INPUT_0>,
+    Scan_Channel<ADC_Input::SEQUENCER_ADC_INPUT_1>,
+    Scan_Channel<ADC_Input::SEQUENCER_ADC_INPUT_2>,
+    Scan_Channel<ADC_Input::SEQUENCER_ADC_INPUT_3, SEQUENCER_ADC_INPUT_3_SAMPLE_LENGTH>,
+    Scan_Channel<ADC_Input::GND>>;
+
+/**
+ * \brief The scan sequencer.
+ */
+Sequencer sequencer{ SEQUENCER_ADC::instance(),
+                     ADC_Reference::SEQUENCER_ADC_REFERENCE,
+                     ADC_Sampling_Capacitance::SEQUENCER_ADC_SAMPLING_CAPACITANCE,
+                     ADC_Clock_Prescaler::SEQUENCER_ADC_CLOCK_PRESCALER,
+                     ADC_Resolution::SEQUENCER_ADC_RESOLUTION };
+
+} // namespace
+
+/**
+ * \brief Sequencer ADC RESRDY interrupt handler.
+ */
+PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND(
+    SEQUENCER_ADC_RESRDY_INTERRUPT_VECTOR,
+    Binding<SEQUENCER_ADC, Source::RESRDY, sequencer, &Sequencer::handle_result_ready> )
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::ADC::Scan_Sequencer scan
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    sequencer.initialize();
+
+    Controller{}.enable_interrupt();
+
+    sequencer.start_scanning();
+
+    for ( ;; ) {
+        while ( sequencer.frame_number() != 0 ) {} // while
+        while ( sequencer.frame_number() == 0 ) {} // while
+
+        Sequencer::Frame frame;
+
+        sequencer.read_frame( frame );
+
+        for ( auto channel = std::uint_fast8_t{}; channel < Sequencer::CHANNELS; ++channel ) {
+            Log::instance().print(
+                channel ? PICOLIBRARY_ROM_STRING( ", " ) : PICOLIBRARY_ROM_STRING( "" ),
+                Decimal{ channel },
+                PICOLIBRARY_ROM_STRING( ": " ),
+                Decimal{ frame[ channel ] } );
+        } // for
+        Log::instance().print( PICOLIBRARY_ROM_STRING( "\n" ) );
+        Log::instance().flush();
+    } // for
+}
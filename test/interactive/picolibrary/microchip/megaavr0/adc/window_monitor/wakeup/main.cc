@@ -0,0 +1,165 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::ADC::Window_Monitor wakeup interactive test
+ *        program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/adc.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Clock_Prescaler;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Input;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Reference;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Resolution;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Sampling_Capacitance;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Window_Mode;
+using ::picolibrary::Microchip::megaAVR0::ADC::Sample;
+using ::picolibrary::Microchip::megaAVR0::ADC::Window_Monitor;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Binding;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Controller;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Source;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The window low threshold.
+ */
+constexpr auto LOW_THRESHOLD = Sample{ MONITOR_ADC_LOW_THRESHOLD };
+
+/**
+ * \brief The window high threshold.
+ */
+constexpr auto HIGH_THRESHOLD = Sample{ MONITOR_ADC_HIGH_THRESHOLD };
+
+/**
+ * \brief The window monitor.
+ */
+Window_Monitor monitor{ MONITOR_ADC::instance(),
+                        ADC_Reference::MONITOR_ADC_REFERENCE,
+                        ADC_Sampling_Capacitance::MONITOR_ADC_SAMPLING_CAPACITANCE,
+                        ADC_Clock_Prescaler::MONITOR_ADC_CLOCK_PRESCALER,
+                        ADC_Resolution::MONITOR_ADC_RESOLUTION };
+
+/**
+ * \brief Get the window comparison mode that detects the return crossing of a window
+ *        comparison mode's condition.
+ *
+ * BELOW and ABOVE are not logical complements ("not below the low threshold" is not
+ * "above the high threshold"): switching between them relies on the gap between the low
+ * and high thresholds to provide hysteresis. INSIDE and OUTSIDE are true complements.
+ *
+ * \param[in] adc_window_mode The window comparison mode.
+ *
+ * \return The window comparison mode that detects the return crossing.
+ */
+auto hysteresis_counterpart( ADC_Window_Mode adc_window_mode ) noexcept -> ADC_Window_Mode
+{
+    switch ( adc_window_mode ) {
+        case ADC_Window_Mode::BELOW: return ADC_Window_Mode::ABOVE;
+        case ADC_Window_Mode::ABOVE: return ADC_Window_Mode::BELOW;
+        case ADC_Window_Mode::INSIDE: return ADC_Window_Mode::OUTSIDE;
+        case ADC_Window_Mode::OUTSIDE: return ADC_Window_Mode::INSIDE;
+    } // switch
+
+    return adc_window_mode;
+}
+
+} // namespace
+
+/**
+ * \brief Monitor ADC WCOMP interrupt handler.
+ */
+PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND(
+    MONITOR_ADC_WCOMP_INTERRUPT_VECTOR,
+    Binding<MONITOR_ADC, Source::WCOMP, monitor, &Window_Monitor::handle_window_comparison> )
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::ADC::Window_Monitor wakeup
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    SLPCTRL0::instance().ctrla = SLPCTRL::CTRLA::SMODE_IDLE | SLPCTRL::CTRLA::Mask::SEN;
+
+    auto adc_window_mode = ADC_Window_Mode::MONITOR_ADC_WINDOW_MODE;
+
+    monitor.initialize();
+    monitor.select_input( ADC_Input::MONITOR_ADC_INPUT );
+    monitor.configure_window( adc_window_mode, LOW_THRESHOLD, HIGH_THRESHOLD );
+    monitor.arm();
+
+    Controller interrupt_controller;
+
+    interrupt_controller.enable_interrupt();
+
+    monitor.start_free_running();
+
+    auto wakeups = std::uint16_t{};
+
+    for ( ;; ) {
+        interrupt_controller.disable_interrupt();
+
+        if ( not monitor.condition_detected() ) {
+            // the instruction following sei is always executed before a pending interrupt
+            // is handled, so a WCOMP interrupt that is already pending wakes the CPU
+            // instead of being missed
+            asm volatile( "sei\n\tsleep" ::: "memory" );
+
+            ++wakeups;
+
+            continue;
+        } // if
+
+        interrupt_controller.enable_interrupt();
+
+        Log::instance().print(
+            PICOLIBRARY_ROM_STRING( "window condition detected, sample: " ),
+            Decimal{ monitor.sample() },
+            PICOLIBRARY_ROM_STRING( ", wakeups: " ),
+            Decimal{ wakeups },
+            PICOLIBRARY_ROM_STRING( "\n" ) );
+        Log::instance().flush();
+
+        wakeups = 0;
+
+        adc_window_mode = hysteresis_counterpart( adc_window_mode );
+
+        monitor.configure_window( adc_window_mode, LOW_THRESHOLD, HIGH_THRESHOLD );
+        monitor.arm();
+    } // for
+}
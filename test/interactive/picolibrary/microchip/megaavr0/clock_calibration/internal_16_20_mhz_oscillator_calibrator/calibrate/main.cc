@@ -0,0 +1,139 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Calibrator
+ *        calibrate interactive test program.
+ */
+
+#include <avr-libcpp/delay>
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/clock.h"
+#include "picolibrary/microchip/megaavr0/clock_calibration.h"
+#include "picolibrary/microchip/megaavr0/clock_plan.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::Clock::enable_external_32_768_kHz_crystal_oscillator;
+using ::picolibrary::Microchip::megaAVR0::Clock::external_32_768_kHz_crystal_oscillator_stable;
+using ::picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Calibrator;
+using ::picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Frequency;
+using ::picolibrary::Microchip::megaAVR0::Clock::Plan;
+using ::picolibrary::Microchip::megaAVR0::Clock::Prescaler;
+using ::picolibrary::Microchip::megaAVR0::Clock::Prescaler_Value;
+using ::picolibrary::Microchip::megaAVR0::Clock::Source;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Static_Binding;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The clock plan.
+ */
+using Clock_Plan = Plan<
+    Source::INTERNAL_16_20_MHz_OSCILLATOR,
+    Internal_16_20_MHz_Oscillator_Frequency::INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY,
+    Prescaler_Value::PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_CONFIGURE_CLOCK_CLOCK_PRESCALER_VALUE,
+    Prescaler::PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_CONFIGURE_CLOCK_CLOCK_PRESCALER_CONFIGURATION>;
+
+/**
+ * \brief The internal 16/20 MHz oscillator calibrator.
+ */
+using Calibrator =
+    Internal_16_20_MHz_Oscillator_Calibrator<Clock_Plan, CALIBRATOR_TCB, EVSYS::CALIBRATOR_EVSYS_CHANNEL>;
+
+/**
+ * \brief Report the internal 16/20 MHz oscillator's calibration value and the measured
+ *        reference clock period.
+ *
+ * \param[in] count The measured reference clock period.
+ */
+void report( std::uint16_t count ) noexcept
+{
+    Log::instance().print(
+        PICOLIBRARY_ROM_STRING( "CAL20M: " ),
+        Decimal{ static_cast<std::uint8_t>( Calibrator::calibration_value() ) },
+        PICOLIBRARY_ROM_STRING( ", count: " ),
+        Decimal{ count },
+        PICOLIBRARY_ROM_STRING( ", target: " ),
+        Decimal{ Calibrator::TARGET_COUNT },
+        PICOLIBRARY_ROM_STRING( "\n" ) );
+    Log::instance().flush();
+}
+
+} // namespace
+
+/**
+ * \brief Calibrator TCB interrupt handler.
+ */
+PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND(
+    CALIBRATOR_TCB_INTERRUPT_VECTOR,
+    Static_Binding<CALIBRATOR_TCB, ::picolibrary::Microchip::megaAVR0::Interrupt::Source::INT, &Calibrator::track> )
+
+/**
+ * \brief Execute the
+ *        picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Calibrator
+ *        calibrate interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    enable_external_32_768_kHz_crystal_oscillator();
+
+    while ( not external_32_768_kHz_crystal_oscillator_stable() ) {} // while
+
+    Calibrator::initialize();
+
+    Log::instance().print( PICOLIBRARY_ROM_STRING( "factory calibration:\n" ) );
+    report( Calibrator::measure() );
+
+    Calibrator::calibrate();
+
+    Log::instance().print( PICOLIBRARY_ROM_STRING( "calibrated:\n" ) );
+    report( Calibrator::measure() );
+
+    Log::instance().print( PICOLIBRARY_ROM_STRING( "tracking:\n" ) );
+
+    Calibrator::enable_tracking();
+
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Controller{}.enable_interrupt();
+
+    for ( ;; ) {
+        avrlibcpp::delay_ms( 1000 );
+
+        Log::instance().print(
+            PICOLIBRARY_ROM_STRING( "CAL20M: " ),
+            Decimal{ static_cast<std::uint8_t>( Calibrator::calibration_value() ) },
+            PICOLIBRARY_ROM_STRING( "\n" ) );
+        Log::instance().flush();
+    } // for
+}
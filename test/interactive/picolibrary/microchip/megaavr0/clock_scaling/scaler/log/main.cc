@@ -0,0 +1,122 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Clock::Scaler log interactive test program.
+ */
+
+#include <avr-libcpp/delay>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/asynchronous_serial.h"
+#include "picolibrary/microchip/megaavr0/clock.h"
+#include "picolibrary/microchip/megaavr0/clock_plan.h"
+#include "picolibrary/microchip/megaavr0/clock_scaling.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Clock_Generator_Operating_Speed;
+using ::picolibrary::Microchip::megaAVR0::Clock::Internal_16_20_MHz_Oscillator_Frequency;
+using ::picolibrary::Microchip::megaAVR0::Clock::Plan;
+using ::picolibrary::Microchip::megaAVR0::Clock::Prescaler;
+using ::picolibrary::Microchip::megaAVR0::Clock::Prescaler_Value;
+using ::picolibrary::Microchip::megaAVR0::Clock::Scaler;
+using ::picolibrary::Microchip::megaAVR0::Clock::Source;
+using ::picolibrary::Microchip::megaAVR0::Clock::USART_Retimer;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The fast clock plan.
+ */
+using Fast_Plan = Plan<
+    Source::INTERNAL_16_20_MHz_OSCILLATOR,
+    Internal_16_20_MHz_Oscillator_Frequency::INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY,
+    Prescaler_Value::FAST_PLAN_CLOCK_PRESCALER_VALUE,
+    Prescaler::FAST_PLAN_CLOCK_PRESCALER_CONFIGURATION>;
+
+/**
+ * \brief The slow clock plan.
+ */
+using Slow_Plan = Plan<
+    Source::INTERNAL_16_20_MHz_OSCILLATOR,
+    Internal_16_20_MHz_Oscillator_Frequency::INTERNAL_16_20_MHz_OSCILLATOR_FREQUENCY,
+    Prescaler_Value::SLOW_PLAN_CLOCK_PRESCALER_VALUE,
+    Prescaler::SLOW_PLAN_CLOCK_PRESCALER_CONFIGURATION>;
+
+/**
+ * \brief The clock scaler.
+ */
+using Clock_Scaler = Scaler<USART_Retimer<
+    PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_LOG_USART,
+    LOG_USART_BAUD_RATE,
+    USART_Clock_Generator_Operating_Speed::PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR0_LOG_USART_CLOCK_GENERATOR_OPERATING_SPEED>>;
+
+/**
+ * \brief Scale the clock to match a clock plan, and report the resulting peripheral
+ *        clock frequency.
+ *
+ * \tparam Clock_Plan The clock plan.
+ */
+template<typename Clock_Plan>
+void scale() noexcept
+{
+    Clock_Scaler::scale<Clock_Plan>();
+
+    Log::instance().print(
+        PICOLIBRARY_ROM_STRING( "CLK_PER: " ),
+        Decimal{ Clock_Plan::CLK_PER_FREQUENCY },
+        PICOLIBRARY_ROM_STRING( " Hz\n" ) );
+    Log::instance().flush();
+
+    avrlibcpp::delay_ms( 1000 );
+}
+
+} // namespace
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::Clock::Scaler log interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    if ( not Fast_Plan::frequency_selection_fuse_matches() ) {
+        Log::instance().print( PICOLIBRARY_ROM_STRING(
+            "internal 16/20 MHz oscillator frequency selection fuse mismatch\n" ) );
+        Log::instance().flush();
+
+        for ( ;; ) {} // for
+    }                 // if
+
+    for ( ;; ) {
+        scale<Fast_Plan>();
+        scale<Slow_Plan>();
+    } // for
+}
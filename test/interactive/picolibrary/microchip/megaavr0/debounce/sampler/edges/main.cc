@@ -0,0 +1,105 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Debounce::Sampler edges interactive test
+ *        program.
+ */
+
+#include <avr/interrupt.h>
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/gpio.h"
+#include "picolibrary/microchip/megaavr0/debounce.h"
+#include "picolibrary/microchip/megaavr0/gpio.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Binary;
+using ::picolibrary::GPIO::Initial_Pull_Up_State;
+using ::picolibrary::Microchip::megaAVR0::Debounce::PIT_Clock_Source;
+using ::picolibrary::Microchip::megaAVR0::Debounce::PIT_Period;
+using ::picolibrary::Microchip::megaAVR0::Debounce::Sampler;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Internally_Pulled_Up_Input_Pin;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The debounced input sampler.
+ */
+Sampler<INPUTS_VPORT> sampler{};
+
+} // namespace
+
+/**
+ * \brief RTC PIT interrupt handler.
+ */
+ISR( RTC_PIT_vect )
+{
+    sampler.sample();
+}
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::Debounce::Sampler edges
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    auto inputs = Internally_Pulled_Up_Input_Pin{ INPUTS_PORT::instance(), INPUTS_MASK };
+
+    inputs.initialize( Initial_Pull_Up_State::ENABLED );
+
+    sampler.initialize(
+        PIT_Clock_Source::INTERNAL_32_768_kHz_OSCILLATOR,
+        PIT_Period::INPUTS_SAMPLE_PERIOD );
+
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Controller{}.enable_interrupt();
+
+    for ( ;; ) {
+        auto const rising_edges = static_cast<std::uint8_t>(
+            sampler.take_rising_edges( 0 ) & INPUTS_MASK );
+        auto const falling_edges = static_cast<std::uint8_t>(
+            sampler.take_falling_edges( 0 ) & INPUTS_MASK );
+
+        if ( rising_edges or falling_edges ) {
+            Log::instance().print(
+                PICOLIBRARY_ROM_STRING( "state: " ),
+                Binary{ static_cast<std::uint8_t>( sampler.state( 0 ) & INPUTS_MASK ) },
+                PICOLIBRARY_ROM_STRING( ", rising edges: " ),
+                Binary{ rising_edges },
+                PICOLIBRARY_ROM_STRING( ", falling edges: " ),
+                Binary{ falling_edges },
+                PICOLIBRARY_ROM_STRING( "\n" ) );
+            Log::instance().flush();
+        } // if
+    }     // for
+}
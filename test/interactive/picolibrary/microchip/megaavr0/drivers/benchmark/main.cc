@@ -0,0 +1,351 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0 drivers benchmark interactive test program.
+ */
+
+#include <avr-libcpp/delay>
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/i2c.h"
+#include "picolibrary/microchip/megaavr0/asynchronous_serial.h"
+#include "picolibrary/microchip/megaavr0/gpio.h"
+#include "picolibrary/microchip/megaavr0/i2c.h"
+#include "picolibrary/microchip/megaavr0/multiplexed_signals.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/peripheral/tca.h"
+#include "picolibrary/microchip/megaavr0/spi.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::I2C::Address_Numeric;
+using ::picolibrary::I2C::Address_Transmitted;
+using ::picolibrary::I2C::Operation;
+using ::picolibrary::I2C::Response;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::Transmitter;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Clock_Generator_Operating_Speed;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Data_Bits;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Parity;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Stop_Bits;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Push_Pull_IO_Pin;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Static_Push_Pull_IO_Pin;
+using ::picolibrary::Microchip::megaAVR0::I2C::Basic_Controller;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Bus_Speed;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Inactive_Bus_Time_Out;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_SDA_Hold_Time;
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::SPI_Route;
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::TWI_Route;
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::USART_Route;
+using ::picolibrary::Microchip::megaAVR0::SPI::Fixed_Configuration_Controller;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Bit_Order;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Clock_Phase;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Clock_Polarity;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Clock_Rate;
+using ::picolibrary::ROM::String;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The number of bytes transferred by block operations.
+ */
+constexpr auto BLOCK_SIZE = std::uint_fast8_t{ 8 };
+
+/**
+ * \brief Block operation transmit data.
+ */
+constexpr std::uint8_t TX_DATA[ BLOCK_SIZE ]{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+};
+
+/**
+ * \brief Block operation receive data.
+ */
+std::uint8_t rx_data[ BLOCK_SIZE ]{};
+
+/**
+ * \brief Operation execution time measurement.
+ */
+struct Measurement {
+    /**
+     * \brief The operation's execution time in CLK_PER cycles.
+     */
+    std::uint16_t cycles;
+
+    /**
+     * \brief The operation's execution time exceeded the timer TCA's period (the
+     *        measured cycles are not valid).
+     */
+    bool overflow;
+};
+
+/**
+ * \brief Measure the execution time of an operation.
+ *
+ * \tparam Operation The type of operation to measure.
+ *
+ * \param[in] operation The operation to measure.
+ *
+ * \return The operation's execution time measurement.
+ */
+template<typename Operation>
+auto measure( Operation operation ) noexcept -> Measurement
+{
+    auto & timer = TIMER_TCA::instance();
+
+    // the counter is restarted so that a single overflow means that the operation took
+    // longer than the timer's period
+    timer.normal.cnt      = 0;
+    timer.normal.intflags = TCA::Normal::INTFLAGS::Mask::OVF;
+
+    std::uint16_t const start = timer.normal.cnt;
+
+    operation();
+
+    std::uint16_t const end = timer.normal.cnt;
+
+    return { static_cast<std::uint16_t>( end - start ),
+             static_cast<bool>( timer.normal.intflags & TCA::Normal::INTFLAGS::Mask::OVF ) };
+}
+
+/**
+ * \brief Measure and report the execution time of an operation.
+ *
+ * \tparam Operation The type of operation to measure.
+ *
+ * \param[in] name The name of the operation.
+ * \param[in] bytes The number of bytes transferred by the operation.
+ * \param[in] operation The operation to measure.
+ */
+template<typename Operation>
+void report( String name, std::uint_fast8_t bytes, Operation operation ) noexcept
+{
+    // let previously started transfers complete
+    avrlibcpp::delay_ms( 10 );
+
+    auto const baseline    = measure( []() noexcept {} );
+    auto const measurement = measure( operation );
+
+    Log::instance().print( name, ',', Decimal{ static_cast<std::uint8_t>( bytes ) }, ',' );
+
+    if ( measurement.overflow ) {
+        Log::instance().print( PICOLIBRARY_ROM_STRING( "overflow\n" ) );
+    } else {
+        Log::instance().print(
+            Decimal{ static_cast<std::uint16_t>( measurement.cycles - baseline.cycles ) }, '\n' );
+    } // else
+
+    Log::instance().flush();
+}
+
+/**
+ * \brief Benchmark the asynchronous serial transmitter.
+ */
+void benchmark_transmitter() noexcept
+{
+    auto transmitter = Transmitter<std::uint8_t>{
+        TRANSMITTER_USART::instance(),
+        USART_Data_Bits::_8,
+        USART_Parity::NONE,
+        USART_Stop_Bits::_1,
+        USART_Clock_Generator_Operating_Speed::NORMAL,
+        TRANSMITTER_USART_CLOCK_GENERATOR_SCALING_FACTOR,
+        USART_Route::TRANSMITTER_USART_ROUTE
+    };
+
+    transmitter.initialize();
+
+    report(
+        PICOLIBRARY_ROM_STRING( "Asynchronous_Serial::Transmitter::transmit(data)" ),
+        1,
+        [ &transmitter ]() noexcept { transmitter.transmit( TX_DATA[ 0 ] ); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "Asynchronous_Serial::Transmitter::transmit(block)" ),
+        BLOCK_SIZE,
+        [ &transmitter ]() noexcept {
+            transmitter.transmit( TX_DATA, TX_DATA + BLOCK_SIZE );
+        } );
+}
+
+/**
+ * \brief Benchmark the SPI controller.
+ */
+void benchmark_spi_controller() noexcept
+{
+    auto controller = Fixed_Configuration_Controller<SPI>{
+        CONTROLLER_SPI::instance(),
+        SPI_Clock_Rate::CONTROLLER_SPI_CLOCK_RATE,
+        SPI_Clock_Polarity::IDLE_LOW,
+        SPI_Clock_Phase::CAPTURE_IDLE_TO_ACTIVE,
+        SPI_Bit_Order::MSB_FIRST,
+        SPI_Route::CONTROLLER_SPI_ROUTE
+    };
+
+    controller.initialize();
+
+    report(
+        PICOLIBRARY_ROM_STRING( "SPI::Fixed_Configuration_Controller::exchange(data)" ),
+        1,
+        [ &controller ]() noexcept {
+            static_cast<void>( controller.exchange( TX_DATA[ 0 ] ) );
+        } );
+    report(
+        PICOLIBRARY_ROM_STRING( "SPI::Fixed_Configuration_Controller::exchange(block)" ),
+        BLOCK_SIZE,
+        [ &controller ]() noexcept {
+            controller.exchange(
+                TX_DATA, TX_DATA + BLOCK_SIZE, rx_data, rx_data + BLOCK_SIZE );
+        } );
+    report(
+        PICOLIBRARY_ROM_STRING( "SPI::Fixed_Configuration_Controller::receive(block)" ),
+        BLOCK_SIZE,
+        [ &controller ]() noexcept {
+            controller.receive( rx_data, rx_data + BLOCK_SIZE );
+        } );
+    report(
+        PICOLIBRARY_ROM_STRING( "SPI::Fixed_Configuration_Controller::transmit(block)" ),
+        BLOCK_SIZE,
+        [ &controller ]() noexcept {
+            controller.transmit( TX_DATA, TX_DATA + BLOCK_SIZE );
+        } );
+}
+
+/**
+ * \brief Benchmark the I2C basic controller.
+ */
+void benchmark_i2c_controller() noexcept
+{
+    auto controller = Basic_Controller{ CONTROLLER_TWI::instance(),
+                                        TWI_SDA_Hold_Time::OFF,
+                                        TWI_Bus_Speed::STANDARD,
+                                        CONTROLLER_TWI_CLOCK_GENERATOR_SCALING_FACTOR,
+                                        TWI_Inactive_Bus_Time_Out::DISABLED,
+                                        TWI_Route::CONTROLLER_TWI_ROUTE };
+
+    controller.initialize();
+
+    auto const address = Address_Transmitted{ Address_Numeric{ DEVICE_ADDRESS } };
+
+    auto response = Response::NACK;
+
+    report(
+        PICOLIBRARY_ROM_STRING( "I2C::Basic_Controller::address(write)+stop" ),
+        0,
+        [ &controller, &address, &response ]() noexcept {
+            controller.start();
+            response = controller.address( address, Operation::WRITE );
+            controller.stop();
+        } );
+
+    if ( response != Response::ACK ) {
+        return;
+    } // if
+
+    controller.start();
+    static_cast<void>( controller.address( address, Operation::WRITE ) );
+
+    report(
+        PICOLIBRARY_ROM_STRING( "I2C::Basic_Controller::write(data)" ),
+        1,
+        [ &controller ]() noexcept {
+            static_cast<void>( controller.write( TX_DATA[ 0 ] ) );
+        } );
+    report(
+        PICOLIBRARY_ROM_STRING( "I2C::Basic_Controller::write(block)" ),
+        BLOCK_SIZE,
+        [ &controller ]() noexcept {
+            for ( auto const data : TX_DATA ) {
+                static_cast<void>( controller.write( data ) );
+            } // for
+        } );
+
+    controller.stop();
+}
+
+/**
+ * \brief Benchmark the GPIO pins.
+ */
+void benchmark_gpio() noexcept
+{
+    auto pin        = Push_Pull_IO_Pin<VPORT>{ PIN_VPORT::instance(), 1 << PIN_BIT };
+    auto static_pin = Static_Push_Pull_IO_Pin<PIN_VPORT, PIN_BIT>{};
+
+    pin.initialize();
+    static_pin.initialize();
+
+    report(
+        PICOLIBRARY_ROM_STRING( "GPIO::Push_Pull_IO_Pin<VPORT>::transition_to_high" ),
+        0,
+        [ &pin ]() noexcept { pin.transition_to_high(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "GPIO::Push_Pull_IO_Pin<VPORT>::transition_to_low" ),
+        0,
+        [ &pin ]() noexcept { pin.transition_to_low(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "GPIO::Push_Pull_IO_Pin<VPORT>::toggle" ),
+        0,
+        [ &pin ]() noexcept { pin.toggle(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "GPIO::Static_Push_Pull_IO_Pin::transition_to_high" ),
+        0,
+        [ &static_pin ]() noexcept { static_pin.transition_to_high(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "GPIO::Static_Push_Pull_IO_Pin::transition_to_low" ),
+        0,
+        [ &static_pin ]() noexcept { static_pin.transition_to_low(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "GPIO::Static_Push_Pull_IO_Pin::toggle" ),
+        0,
+        [ &static_pin ]() noexcept { static_pin.toggle(); } );
+}
+
+} // namespace
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0 drivers benchmark interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    TIMER_TCA::instance().normal.ctrla = TCA::Normal::CTRLA::CLKSEL_DIV1
+                                         | TCA::Normal::CTRLA::Mask::ENABLE;
+
+    Log::instance().print( PICOLIBRARY_ROM_STRING( "operation,bytes,cycles\n" ) );
+
+    benchmark_transmitter();
+    benchmark_spi_controller();
+    benchmark_i2c_controller();
+    benchmark_gpio();
+
+    Log::instance().print( PICOLIBRARY_ROM_STRING( "end\n" ) );
+    Log::instance().flush();
+
+    for ( ;; ) {} // for
+}
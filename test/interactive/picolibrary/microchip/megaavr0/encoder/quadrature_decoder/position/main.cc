@@ -0,0 +1,114 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Encoder::Quadrature_Decoder position
+ *        interactive test program.
+ */
+
+#include <avr/interrupt.h>
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/gpio.h"
+#include "picolibrary/microchip/megaavr0/encoder.h"
+#include "picolibrary/microchip/megaavr0/gpio.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::GPIO::Initial_Pull_Up_State;
+using ::picolibrary::Microchip::megaAVR0::Encoder::Quadrature_Decoder;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Internally_Pulled_Up_Input_Pin;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Handler;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Interrupt_Dispatcher;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Sense;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The quadrature decoder.
+ */
+using Decoder = Quadrature_Decoder<ENCODER_VPORT, ENCODER_A_BIT, ENCODER_B_BIT>;
+
+/**
+ * \brief The encoder pin change interrupt dispatcher.
+ */
+using Dispatcher = Pin_Change_Interrupt_Dispatcher<
+    ENCODER_PORT,
+    Pin_Change_Handler<ENCODER_A_BIT, Pin_Change_Sense::BOTH_EDGES, Decoder::update>,
+    Pin_Change_Handler<ENCODER_B_BIT, Pin_Change_Sense::BOTH_EDGES, Decoder::update>>;
+
+} // namespace
+
+/**
+ * \brief GPIO port interrupt handler.
+ */
+ISR( ENCODER_PORT_INTERRUPT_VECTOR )
+{
+    Dispatcher::handle_interrupt();
+}
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::Encoder::Quadrature_Decoder
+ *        position interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    auto a = Internally_Pulled_Up_Input_Pin{ ENCODER_PORT::instance(),
+                                             1 << ENCODER_A_BIT };
+    auto b = Internally_Pulled_Up_Input_Pin{ ENCODER_PORT::instance(),
+                                             1 << ENCODER_B_BIT };
+
+    a.initialize( Initial_Pull_Up_State::ENABLED );
+    b.initialize( Initial_Pull_Up_State::ENABLED );
+
+    Decoder::initialize();
+    Dispatcher::initialize();
+
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Controller{}.enable_interrupt();
+
+    auto reported_position = std::int16_t{};
+
+    for ( ;; ) {
+        auto const position = Decoder::position();
+
+        if ( position != reported_position ) {
+            Log::instance().print(
+                PICOLIBRARY_ROM_STRING( "position: " ),
+                Decimal{ position },
+                PICOLIBRARY_ROM_STRING( "\n" ) );
+            Log::instance().flush();
+
+            reported_position = position;
+        } // if
+    }     // for
+}
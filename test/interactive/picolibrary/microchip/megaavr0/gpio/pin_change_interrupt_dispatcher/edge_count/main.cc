@@ -0,0 +1,160 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Interrupt_Dispatcher edge
+ *        count interactive test program.
+ */
+
+#include <avr/interrupt.h>
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/gpio.h"
+#include "picolibrary/microchip/megaavr0/gpio.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::GPIO::Initial_Pull_Up_State;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Internally_Pulled_Up_Input_Pin;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Handler;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Interrupt_Dispatcher;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Sense;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The number of falling edges detected on pin A.
+ */
+std::uint16_t volatile pin_a_falling_edges{};
+
+/**
+ * \brief The number of edges detected on pin B.
+ */
+std::uint16_t volatile pin_b_edges{};
+
+/**
+ * \brief Handle a pin A falling edge.
+ */
+void handle_pin_a_falling_edge() noexcept
+{
+    pin_a_falling_edges = pin_a_falling_edges + 1;
+}
+
+/**
+ * \brief Handle a pin B edge.
+ */
+void handle_pin_b_edge() noexcept
+{
+    pin_b_edges = pin_b_edges + 1;
+}
+
+/**
+ * \brief The pin change interrupt dispatcher.
+ */
+using Dispatcher = Pin_Change_Interrupt_Dispatcher<
+    PINS_PORT,
+    Pin_Change_Handler<PIN_A_BIT, Pin_Change_Sense::FALLING_EDGE,
+                       handle_pin_a_falling_edge>,
+    Pin_Change_Handler<PIN_B_BIT, Pin_Change_Sense::BOTH_EDGES, handle_pin_b_edge>>;
+
+/**
+ * \brief Read an edge count.
+ *
+ * \param[in] count The edge count to read.
+ *
+ * \return The edge count.
+ */
+auto read( std::uint16_t volatile const & count ) noexcept -> std::uint16_t
+{
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Controller controller{};
+
+    auto const interrupt_enable_state = controller.save_interrupt_enable_state();
+
+    controller.disable_interrupt();
+
+    std::uint16_t const value = count;
+
+    controller.restore_interrupt_enable_state( interrupt_enable_state );
+
+    return value;
+}
+
+} // namespace
+
+/**
+ * \brief GPIO port interrupt handler.
+ */
+ISR( PINS_PORT_INTERRUPT_VECTOR )
+{
+    Dispatcher::handle_interrupt();
+}
+
+/**
+ * \brief Execute the
+ *        picolibrary::Microchip::megaAVR0::GPIO::Pin_Change_Interrupt_Dispatcher edge
+ *        count interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    auto pin_a = Internally_Pulled_Up_Input_Pin{ PINS_PORT::instance(), 1 << PIN_A_BIT };
+    auto pin_b = Internally_Pulled_Up_Input_Pin{ PINS_PORT::instance(), 1 << PIN_B_BIT };
+
+    pin_a.initialize( Initial_Pull_Up_State::ENABLED );
+    pin_b.initialize( Initial_Pull_Up_State::ENABLED );
+
+    Dispatcher::initialize();
+
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Controller{}.enable_interrupt();
+
+    auto reported_pin_a_falling_edges = std::uint16_t{};
+    auto reported_pin_b_edges         = std::uint16_t{};
+
+    for ( ;; ) {
+        auto const pin_a_falling_edges = read( ::pin_a_falling_edges );
+        auto const pin_b_edges         = read( ::pin_b_edges );
+
+        if ( pin_a_falling_edges != reported_pin_a_falling_edges
+             or pin_b_edges != reported_pin_b_edges ) {
+            Log::instance().print(
+                PICOLIBRARY_ROM_STRING( "pin A falling edges: " ),
+                Decimal{ pin_a_falling_edges },
+                PICOLIBRARY_ROM_STRING( ", pin B edges: " ),
+                Decimal{ pin_b_edges },
+                PICOLIBRARY_ROM_STRING( "\n" ) );
+            Log::instance().flush();
+
+            reported_pin_a_falling_edges = pin_a_falling_edges;
+            reported_pin_b_edges         = pin_b_edges;
+        } // if
+    }     // for
+}
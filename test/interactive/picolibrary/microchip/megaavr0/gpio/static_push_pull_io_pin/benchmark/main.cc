@@ -0,0 +1,159 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::GPIO::Static_Push_Pull_IO_Pin benchmark
+ *        interactive test program.
+ */
+
+#include <cstdint>
+#include <utility>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/gpio.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/peripheral/tca.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Push_Pull_IO_Pin;
+using ::picolibrary::Microchip::megaAVR0::GPIO::Static_Push_Pull_IO_Pin;
+using ::picolibrary::ROM::String;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The number of transitions performed per measurement.
+ */
+constexpr auto TRANSITIONS = std::size_t{ 16 };
+
+/**
+ * \brief PORT based push-pull I/O pin.
+ */
+Push_Pull_IO_Pin<PORT> port_pin{ PIN_PORT::instance(), 1 << PIN_BIT };
+
+/**
+ * \brief VPORT based push-pull I/O pin.
+ */
+Push_Pull_IO_Pin<VPORT> vport_pin{ PIN_VPORT::instance(), 1 << PIN_BIT };
+
+/**
+ * \brief Compile-time push-pull I/O pin.
+ */
+Static_Push_Pull_IO_Pin<PIN_VPORT, PIN_BIT> static_pin{};
+
+/**
+ * \brief Execute a sequence of transitions.
+ *
+ * \tparam Transition The type of transition to execute.
+ * \tparam INDICES The transition indices.
+ *
+ * \param[in] transition The transition to execute.
+ *
+ * \return The sequence's execution time in CPU cycles.
+ */
+template<typename Transition, std::size_t... INDICES>
+auto measure( Transition transition, std::index_sequence<INDICES...> ) noexcept
+    -> std::uint16_t
+{
+    auto & timer = TIMER_TCA::instance();
+
+    std::uint16_t const start = timer.normal.cnt;
+
+    ( ( static_cast<void>( INDICES ), transition() ), ... );
+
+    std::uint16_t const end = timer.normal.cnt;
+
+    return end - start;
+}
+
+/**
+ * \brief Measure and report the cost of a pin transition.
+ *
+ * \tparam Transition The type of transition to measure.
+ *
+ * \param[in] name The name of the transition.
+ * \param[in] transition The transition to measure.
+ */
+template<typename Transition>
+void report( String name, Transition transition ) noexcept
+{
+    auto const sequence = std::make_index_sequence<TRANSITIONS>{};
+
+    auto const baseline = measure( []() noexcept {}, sequence );
+    auto const cycles   = measure( transition, sequence );
+
+    Log::instance().print(
+        name,
+        PICOLIBRARY_ROM_STRING( ": " ),
+        Decimal{ static_cast<std::uint16_t>( cycles - baseline ) / TRANSITIONS },
+        PICOLIBRARY_ROM_STRING( " cycles/transition\n" ) );
+    Log::instance().flush();
+}
+
+} // namespace
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::GPIO::Static_Push_Pull_IO_Pin
+ *        benchmark interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    TIMER_TCA::instance().normal.ctrla = TCA::Normal::CTRLA::CLKSEL_DIV1
+                                         | TCA::Normal::CTRLA::Mask::ENABLE;
+
+    port_pin.initialize();
+    vport_pin.initialize();
+    static_pin.initialize();
+
+    report( PICOLIBRARY_ROM_STRING( "Push_Pull_IO_Pin<PORT> toggle" ), []() noexcept {
+        port_pin.toggle();
+    } );
+    report( PICOLIBRARY_ROM_STRING( "Push_Pull_IO_Pin<VPORT> toggle" ), []() noexcept {
+        vport_pin.toggle();
+    } );
+    report( PICOLIBRARY_ROM_STRING( "Static_Push_Pull_IO_Pin toggle" ), []() noexcept {
+        static_pin.toggle();
+    } );
+    report(
+        PICOLIBRARY_ROM_STRING( "Push_Pull_IO_Pin<VPORT> transition to high" ),
+        []() noexcept { vport_pin.transition_to_high(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "Static_Push_Pull_IO_Pin transition to high" ),
+        []() noexcept { static_pin.transition_to_high(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "Push_Pull_IO_Pin<VPORT> transition to low" ),
+        []() noexcept { vport_pin.transition_to_low(); } );
+    report(
+        PICOLIBRARY_ROM_STRING( "Static_Push_Pull_IO_Pin transition to low" ),
+        []() noexcept { static_pin.transition_to_low(); } );
+
+    for ( ;; ) {} // for
+}
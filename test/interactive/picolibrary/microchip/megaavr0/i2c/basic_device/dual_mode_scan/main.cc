@@ -0,0 +1,117 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::I2C::Basic_Device dual mode scan interactive
+ *        test program.
+ */
+
+#include <avr/interrupt.h>
+
+#include "picolibrary/i2c.h"
+#include "picolibrary/microchip/megaavr0/i2c.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/multiplexed_signals.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/testing/interactive/i2c.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::I2C::Address_Numeric;
+using ::picolibrary::I2C::Response;
+using ::picolibrary::Microchip::megaAVR0::I2C::Basic_Device;
+using ::picolibrary::Microchip::megaAVR0::I2C::Controller;
+using ::picolibrary::Microchip::megaAVR0::I2C::Device_Event;
+using ::picolibrary::Microchip::megaAVR0::I2C::enable_dual_mode;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Bus_Speed;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Inactive_Bus_Time_Out;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_SDA_Hold_Time;
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::TWI_Route;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The device that is scanned for.
+ */
+Basic_Device device;
+
+} // namespace
+
+/**
+ * \brief TWI client interrupt handler.
+ */
+ISR( TWI0_TWIS_vect )
+{
+    switch ( device.event() ) {
+        case Device_Event::NONE: return;
+        case Device_Event::ADDRESSED_FOR_READ:
+        case Device_Event::ADDRESSED_FOR_WRITE:
+        case Device_Event::DATA_RECEIVED: device.respond( Response::ACK ); return;
+        case Device_Event::DATA_REQUESTED:
+            if ( device.nack_received() ) {
+                device.complete_transaction();
+                return;
+            } // if
+
+            device.transmit( 0xFF );
+            return;
+        case Device_Event::STOP:
+        case Device_Event::BUS_ERROR:
+        case Device_Event::COLLISION: device.complete_transaction(); return;
+    } // switch
+}
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::I2C::Basic_Device dual mode scan
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    enable_dual_mode(
+        DUAL_MODE_TWI::instance(),
+        TWI_SDA_Hold_Time::DEVICE_TWI_SDA_HOLD_TIME,
+        TWI_Bus_Speed::DEVICE_TWI_BUS_SPEED,
+        TWI_Route::DUAL_MODE_TWI_ROUTE );
+
+    device = Basic_Device{ DUAL_MODE_TWI::instance(), Address_Numeric{ DEVICE_ADDRESS } };
+
+    device.initialize();
+    device.enable_interrupts();
+
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Controller{}.enable_interrupt();
+
+    ::picolibrary::Testing::Interactive::I2C::scan(
+        Log::instance(),
+        Controller{ DUAL_MODE_TWI::instance(),
+                    TWI_SDA_Hold_Time::CONTROLLER_TWI_SDA_HOLD_TIME,
+                    TWI_Bus_Speed::CONTROLLER_TWI_BUS_SPEED,
+                    CONTROLLER_TWI_CLOCK_GENERATOR_SCALING_FACTOR,
+                    TWI_Inactive_Bus_Time_Out::CONTROLLER_TWI_INACTIVE_BUS_TIME_OUT } );
+
+    for ( ;; ) {} // for
+}
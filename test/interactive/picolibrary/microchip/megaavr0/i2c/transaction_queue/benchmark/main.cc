@@ -0,0 +1,212 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue benchmark interactive
+ *        test program.
+ */
+
+#include <avr/interrupt.h>
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/i2c.h"
+#include "picolibrary/microchip/megaavr0/i2c.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/multiplexed_signals.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/peripheral/tca.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::I2C::Address_Numeric;
+using ::picolibrary::I2C::Operation;
+using ::picolibrary::Microchip::megaAVR0::I2C::Transaction;
+using ::picolibrary::Microchip::megaAVR0::I2C::Transaction_Coalescing;
+using ::picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue;
+using ::picolibrary::Microchip::megaAVR0::I2C::Transaction_State;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Bus_Speed;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Inactive_Bus_Time_Out;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_SDA_Hold_Time;
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::TWI_Route;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The number of times the workload is executed.
+ */
+constexpr auto WORKLOAD_REPETITIONS = std::uint_fast8_t{ 16 };
+
+/**
+ * \brief The number of register reads (register address write transaction followed by a
+ *        register read transaction) in the workload.
+ */
+constexpr auto WORKLOAD_REGISTER_READS = std::uint_fast8_t{ 4 };
+
+/**
+ * \brief Benchmark transaction queue.
+ */
+using Benchmark_Transaction_Queue = Transaction_Queue<2 * WORKLOAD_REGISTER_READS>;
+
+/**
+ * \brief The transaction queue that is being benchmarked.
+ */
+Benchmark_Transaction_Queue * transaction_queue{};
+
+/**
+ * \brief Execute the workload.
+ *
+ * \param[in] transaction_coalescing The transaction coalescing configuration to use.
+ *
+ * \return The workload execution time in timer ticks.
+ */
+auto execute_workload( Transaction_Coalescing transaction_coalescing ) noexcept -> std::uint16_t
+{
+    Benchmark_Transaction_Queue queue{ CONTROLLER_TWI::instance(),
+                                       TWI_SDA_Hold_Time::CONTROLLER_TWI_SDA_HOLD_TIME,
+                                       TWI_Bus_Speed::CONTROLLER_TWI_BUS_SPEED,
+                                       CONTROLLER_TWI_CLOCK_GENERATOR_SCALING_FACTOR,
+                                       TWI_Inactive_Bus_Time_Out::CONTROLLER_TWI_INACTIVE_BUS_TIME_OUT,
+                                       transaction_coalescing,
+                                       TWI_Route::CONTROLLER_TWI_ROUTE };
+
+    queue.initialize();
+    queue.enable_interrupts();
+
+    transaction_queue = &queue;
+
+    auto const address = Address_Numeric{ DEVICE_ADDRESS };
+
+    std::uint8_t register_address[ WORKLOAD_REGISTER_READS ]{};
+    std::uint8_t data[ WORKLOAD_REGISTER_READS ]{};
+
+    for ( auto & value : register_address ) {
+        value = DEVICE_REGISTER;
+    } // for
+
+    Transaction transactions[ 2 * WORKLOAD_REGISTER_READS ]{
+        Transaction{ address, Operation::WRITE, register_address, register_address + 1 },
+        Transaction{ address, Operation::READ, data, data + 1 },
+        Transaction{ address, Operation::WRITE, register_address + 1, register_address + 2 },
+        Transaction{ address, Operation::READ, data + 1, data + 2 },
+        Transaction{ address, Operation::WRITE, register_address + 2, register_address + 3 },
+        Transaction{ address, Operation::READ, data + 2, data + 3 },
+        Transaction{ address, Operation::WRITE, register_address + 3, register_address + 4 },
+        Transaction{ address, Operation::READ, data + 3, data + 4 },
+    };
+
+    auto & timer = TIMER_TCA::instance();
+
+    timer.normal.cnt = 0;
+
+    for ( auto repetition = std::uint_fast8_t{}; repetition < WORKLOAD_REPETITIONS; ++repetition ) {
+        for ( auto & transaction : transactions ) {
+            queue.enqueue( transaction );
+        } // for
+
+        while ( not queue.empty() ) {} // while
+
+        for ( auto const & transaction : transactions ) {
+            if ( transaction.state() != Transaction_State::COMPLETE ) {
+                Log::instance().print( PICOLIBRARY_ROM_STRING( "transaction failed\n" ) );
+                Log::instance().flush();
+
+                for ( ;; ) {} // for
+            } // if
+        }     // for
+    }         // for
+
+    std::uint16_t const ticks = timer.normal.cnt;
+
+    queue.disable_interrupts();
+
+    transaction_queue = nullptr;
+
+    return ticks;
+}
+
+/**
+ * \brief Report the workload's execution time and bus utilization.
+ *
+ * \param[in] transaction_coalescing The transaction coalescing configuration that was
+ *            used.
+ * \param[in] ticks The workload execution time in timer ticks.
+ */
+void report( Transaction_Coalescing transaction_coalescing, std::uint16_t ticks ) noexcept
+{
+    // each register read transfers one register address byte and one register value byte
+    // (9 SCL periods each, including the acknowledge bit)
+    constexpr auto PAYLOAD_SCL_PERIODS = std::uint32_t{ WORKLOAD_REPETITIONS }
+                                         * WORKLOAD_REGISTER_READS * 2 * 9;
+
+    auto const execution_time_us = std::uint32_t{ ticks } * 1'000'000
+                                   / TIMER_TCA_CLOCK_FREQUENCY;
+    auto const payload_time_us = PAYLOAD_SCL_PERIODS * 1'000'000 / CONTROLLER_TWI_SCL_FREQUENCY;
+
+    Log::instance().print(
+        transaction_coalescing == Transaction_Coalescing::ENABLED
+            ? PICOLIBRARY_ROM_STRING( "coalescing enabled: " )
+            : PICOLIBRARY_ROM_STRING( "coalescing disabled: " ),
+        Decimal{ execution_time_us },
+        PICOLIBRARY_ROM_STRING( " us, bus utilization " ),
+        Decimal{ execution_time_us ? payload_time_us * 100 / execution_time_us : 0 },
+        PICOLIBRARY_ROM_STRING( "%\n" ) );
+    Log::instance().flush();
+}
+
+} // namespace
+
+/**
+ * \brief TWI host interrupt handler.
+ */
+ISR( TWI0_TWIM_vect )
+{
+    if ( transaction_queue ) {
+        transaction_queue->service();
+    } // if
+}
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::I2C::Transaction_Queue benchmark
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    auto & timer = TIMER_TCA::instance();
+
+    timer.normal.ctrla = TCA::Normal::CTRLA::CLKSEL_DIV64 | TCA::Normal::CTRLA::Mask::ENABLE;
+
+    ::picolibrary::Microchip::megaAVR0::Interrupt::Controller{}.enable_interrupt();
+
+    report( Transaction_Coalescing::DISABLED, execute_workload( Transaction_Coalescing::DISABLED ) );
+    report( Transaction_Coalescing::ENABLED, execute_workload( Transaction_Coalescing::ENABLED ) );
+
+    for ( ;; ) {} // for
+}
@@ -0,0 +1,112 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Interrupt::Profiler log interactive test
+ *        program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/interrupt_instrumentation.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/interrupt_instrumentation.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Controller;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Instrumented_Binding;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Source;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Static_Binding;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Vector;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Interrupt::print;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The subject TCB interrupt vector number.
+ */
+constexpr auto SUBJECT_VECTOR_NUMBER = Vector<SUBJECT_TCB, Source::INT>::NUMBER;
+
+/**
+ * \brief The interrupt profiler.
+ */
+using Profiler = ::picolibrary::Microchip::megaAVR0::Interrupt::
+    Profiler<PROFILER_TCB, SUBJECT_VECTOR_NUMBER>;
+
+/**
+ * \brief Handle a subject TCB interrupt.
+ */
+void handle_subject_interrupt() noexcept
+{
+    auto & tcb = SUBJECT_TCB::instance();
+
+    Profiler::record_latency<SUBJECT_VECTOR_NUMBER>( tcb.cnt );
+
+    while ( tcb.cnt < SUBJECT_WORKLOAD ) {} // while
+
+    tcb.intflags = TCB::INTFLAGS::Mask::CAPT;
+}
+
+} // namespace
+
+/**
+ * \brief Subject TCB interrupt handler.
+ */
+PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND(
+    SUBJECT_TCB_INTERRUPT_VECTOR,
+    Instrumented_Binding<
+        Profiler,
+        Static_Binding<SUBJECT_TCB, Source::INT, &handle_subject_interrupt>> )
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::Interrupt::Profiler log
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    Profiler::initialize();
+
+    auto & tcb = SUBJECT_TCB::instance();
+
+    tcb.ctrlb   = TCB::CTRLB::CNTMODE_INT;
+    tcb.ccmp    = SUBJECT_PERIOD - 1;
+    tcb.intctrl = TCB::INTCTRL::Mask::CAPT;
+    tcb.ctrla   = TCB::CTRLA::CLKSEL_CLKDIV1 | TCB::CTRLA::Mask::ENABLE;
+
+    Controller{}.enable_interrupt();
+
+    for ( ;; ) {
+        if ( Profiler::duration( 0 ).count() >= REPORT_INTERVAL ) {
+            print<Profiler>( Log::instance() );
+
+            Profiler::reset();
+        } // if
+    }     // for
+}
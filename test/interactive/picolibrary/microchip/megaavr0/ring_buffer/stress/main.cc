@@ -0,0 +1,161 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Ring_Buffer stress interactive test program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/format.h"
+#include "picolibrary/microchip/megaavr0/interrupt.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/ring_buffer.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/clock.h"
+#include "picolibrary/testing/interactive/microchip/megaavr0/log.h"
+
+namespace {
+
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Controller;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Source;
+using ::picolibrary::Microchip::megaAVR0::Interrupt::Static_Binding;
+using ::picolibrary::Microchip::megaAVR0::Ring_Buffer;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::configure_clock;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR0::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief The ring buffer.
+ */
+Ring_Buffer<std::uint8_t, 64> ring_buffer{};
+
+/**
+ * \brief The next value to be written to the ring buffer.
+ */
+std::uint8_t producer_value{};
+
+/**
+ * \brief The number of values that were not written to the ring buffer because it was
+ *        full.
+ */
+std::uint32_t volatile producer_drops{};
+
+/**
+ * \brief Write the next value to the ring buffer.
+ */
+void produce() noexcept
+{
+    PRODUCER_TCB::instance().intflags = TCB::INTFLAGS::Mask::CAPT;
+
+    if ( ring_buffer.full() ) {
+        producer_drops = producer_drops + 1;
+
+        return;
+    } // if
+
+    ring_buffer.push( producer_value++ );
+}
+
+} // namespace
+
+/**
+ * \brief Producer TCB interrupt handler.
+ */
+PICOLIBRARY_MICROCHIP_MEGAAVR0_INTERRUPT_BIND(
+    PRODUCER_TCB_INTERRUPT_VECTOR,
+    Static_Binding<PRODUCER_TCB, Source::INT, &produce> )
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::Ring_Buffer stress interactive
+ *        test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    configure_clock();
+
+    Log::initialize();
+
+    auto & tcb = PRODUCER_TCB::instance();
+
+    tcb.ctrlb   = TCB::CTRLB::CNTMODE_INT;
+    tcb.ccmp    = PRODUCER_PERIOD - 1;
+    tcb.intctrl = TCB::INTCTRL::Mask::CAPT;
+    tcb.ctrla   = TCB::CTRLA::CLKSEL_CLKDIV1 | TCB::CTRLA::Mask::ENABLE;
+
+    Controller{}.enable_interrupt();
+
+    auto consumer_value = std::uint8_t{};
+    auto values         = std::uint32_t{};
+    auto errors         = std::uint32_t{};
+
+    for ( ;; ) {
+        // alternate between element and contiguous span reads
+        if ( values & 0x1 ) {
+            auto const begin = ring_buffer.read_begin();
+            auto const end   = ring_buffer.read_end();
+
+            for ( auto value = begin; value != end; ++value ) {
+                if ( *value != consumer_value++ ) {
+                    ++errors;
+                } // if
+            }     // for
+
+            ring_buffer.commit_read( end - begin );
+
+            values += end - begin;
+        } else if ( not ring_buffer.empty() ) {
+            if ( ring_buffer.front() != consumer_value++ ) {
+                ++errors;
+            } // if
+
+            ring_buffer.pop();
+
+            ++values;
+        } // else if
+
+        if ( values >= 0x10000 ) {
+            Controller interrupt_controller;
+
+            auto const interrupt_enable_state =
+                interrupt_controller.save_interrupt_enable_state();
+
+            interrupt_controller.disable_interrupt();
+
+            std::uint32_t const drops = producer_drops;
+
+            interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+
+            Log::instance().print(
+                PICOLIBRARY_ROM_STRING( "values: " ),
+                Decimal{ values },
+                PICOLIBRARY_ROM_STRING( ", errors: " ),
+                Decimal{ errors },
+                PICOLIBRARY_ROM_STRING( ", drops: " ),
+                Decimal{ drops },
+                PICOLIBRARY_ROM_STRING( "\n" ) );
+            Log::instance().flush();
+
+            values = 0;
+        } // if
+    }     // for
+}
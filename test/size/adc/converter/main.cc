@@ -0,0 +1,72 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::ADC::Converter size report program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/adc.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+
+namespace {
+
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Clock_Prescaler;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Input;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Reference;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Resolution;
+using ::picolibrary::Microchip::megaAVR0::ADC::ADC_Sampling_Capacitance;
+using ::picolibrary::Microchip::megaAVR0::ADC::Converter;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief Driver input (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile input;
+
+/**
+ * \brief Driver output (volatile to prevent the driver operations being optimized away).
+ */
+std::uint16_t volatile output;
+
+} // namespace
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::ADC::Converter size report
+ *        program.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    auto converter = Converter{ ADC0::instance(),
+                                ADC_Reference::VDD,
+                                ADC_Sampling_Capacitance::REDUCED,
+                                ADC_Clock_Prescaler::CLK_PER_16,
+                                ADC_Resolution::_10_BIT };
+
+    converter.initialize();
+
+    for ( ;; ) {
+        converter.select_input( static_cast<ADC_Input>( input ) );
+
+        output = converter.convert();
+    } // for
+}
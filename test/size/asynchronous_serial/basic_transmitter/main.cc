@@ -0,0 +1,72 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::Asynchronous_Serial::Basic_Transmitter size
+ *        report program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/asynchronous_serial.h"
+#include "picolibrary/microchip/megaavr0/multiplexed_signals.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+
+namespace {
+
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::Basic_Transmitter;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Clock_Generator_Operating_Speed;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Data_Bits;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Parity;
+using ::picolibrary::Microchip::megaAVR0::Asynchronous_Serial::USART_Stop_Bits;
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::USART_Route;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief Driver input (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile input;
+
+} // namespace
+
+/**
+ * \brief Execute the
+ *        picolibrary::Microchip::megaAVR0::Asynchronous_Serial::Basic_Transmitter size
+ *        report program.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    auto transmitter = Basic_Transmitter<std::uint8_t>{
+        USART0::instance(),
+        USART_Data_Bits::_8,
+        USART_Parity::NONE,
+        USART_Stop_Bits::_1,
+        USART_Clock_Generator_Operating_Speed::NORMAL,
+        input,
+        USART_Route::DEFAULT
+    };
+
+    transmitter.initialize();
+
+    for ( ;; ) {
+        transmitter.transmit( input );
+    } // for
+}
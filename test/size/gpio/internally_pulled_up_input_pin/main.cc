@@ -0,0 +1,65 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::GPIO::Internally_Pulled_Up_Input_Pin size
+ *        report program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/gpio.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+
+namespace {
+
+using ::picolibrary::Microchip::megaAVR0::GPIO::Internally_Pulled_Up_Input_Pin;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief Driver input (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile input;
+
+/**
+ * \brief Driver output (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile output;
+
+} // namespace
+
+/**
+ * \brief Execute the
+ *        picolibrary::Microchip::megaAVR0::GPIO::Internally_Pulled_Up_Input_Pin size
+ *        report program.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    auto pin = Internally_Pulled_Up_Input_Pin<PORT>{ PORTA::instance(), input };
+
+    pin.initialize();
+
+    for ( ;; ) {
+        pin.enable_pull_up();
+        output = pin.is_high();
+        pin.disable_pull_up();
+    } // for
+}
@@ -0,0 +1,60 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::GPIO::Static_Open_Drain_IO_Pin size report
+ *        program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/gpio.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+
+namespace {
+
+using ::picolibrary::Microchip::megaAVR0::GPIO::Static_Open_Drain_IO_Pin;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+using Pin = Static_Open_Drain_IO_Pin<VPORTA, 0>;
+
+/**
+ * \brief Driver output (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile output;
+
+} // namespace
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::GPIO::Static_Open_Drain_IO_Pin
+ *        size report program.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    Pin::initialize();
+
+    for ( ;; ) {
+        output = Pin::is_high();
+        Pin::transition_to_high();
+        Pin::transition_to_low();
+        Pin::toggle();
+    } // for
+}
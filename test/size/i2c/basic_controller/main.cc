@@ -0,0 +1,89 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::I2C::Basic_Controller size report program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/i2c.h"
+#include "picolibrary/microchip/megaavr0/i2c.h"
+#include "picolibrary/microchip/megaavr0/multiplexed_signals.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+
+namespace {
+
+using ::picolibrary::I2C::Address_Numeric;
+using ::picolibrary::I2C::Address_Transmitted;
+using ::picolibrary::I2C::Operation;
+using ::picolibrary::I2C::Response;
+using ::picolibrary::Microchip::megaAVR0::I2C::Basic_Controller;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Bus_Speed;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_Inactive_Bus_Time_Out;
+using ::picolibrary::Microchip::megaAVR0::I2C::TWI_SDA_Hold_Time;
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::TWI_Route;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief Driver input (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile input;
+
+/**
+ * \brief Driver output (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile output;
+
+} // namespace
+
+/**
+ * \brief Execute the picolibrary::Microchip::megaAVR0::I2C::Basic_Controller size report
+ *        program.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    auto controller = Basic_Controller{ TWI0::instance(),
+                                        TWI_SDA_Hold_Time::OFF,
+                                        TWI_Bus_Speed::STANDARD,
+                                        input,
+                                        TWI_Inactive_Bus_Time_Out::DISABLED,
+                                        TWI_Route::DEFAULT };
+
+    auto const address = Address_Transmitted{ Address_Numeric{ input } };
+
+    controller.initialize();
+
+    for ( ;; ) {
+        controller.start();
+
+        if ( controller.address( address, Operation::WRITE ) == Response::ACK ) {
+            static_cast<void>( controller.write( input ) );
+
+            controller.repeated_start();
+            static_cast<void>( controller.address( address, Operation::READ ) );
+
+            output = controller.read( Response::NACK );
+        } // if
+
+        controller.stop();
+    } // for
+}
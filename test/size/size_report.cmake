@@ -0,0 +1,119 @@
+# picolibrary-microchip-megaavr0
+#
+# Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+# picolibrary-microchip-megaavr0 contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+# file except in compliance with the License. You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software distributed under
+# the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied. See the License for the specific language governing
+# permissions and limitations under the License.
+
+# Description: picolibrary-microchip-megaavr0 size report script.
+#
+# Usage: cmake -D AVR_SIZE=<avr-size> -D REFERENCE=<reference program> -D
+#       ENTRIES=<driver>=<program>[,<driver>=<program>...] -D BASELINE=<baseline> -D
+#       UPDATE_BASELINE=<ON|OFF> -P size_report.cmake
+
+cmake_minimum_required( VERSION 3.16.3 )
+
+# get a program's .text, .data, and .bss section sizes
+function( get_section_sizes program sizes )
+    execute_process(
+        COMMAND "${AVR_SIZE}" --format=berkeley "${program}"
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE  error
+    )
+
+    if( NOT result EQUAL 0 )
+        message( FATAL_ERROR "${AVR_SIZE} failed: ${error}" )
+    endif( NOT result EQUAL 0 )
+
+    if( NOT output MATCHES "\n[ \t]*([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)" )
+        message( FATAL_ERROR "unexpected ${AVR_SIZE} output: ${output}" )
+    endif( NOT output MATCHES "\n[ \t]*([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)" )
+
+    set( ${sizes} "${CMAKE_MATCH_1};${CMAKE_MATCH_2};${CMAKE_MATCH_3}" PARENT_SCOPE )
+endfunction( get_section_sizes program sizes )
+
+set( SECTIONS "text;data;bss" )
+
+get_section_sizes( "${REFERENCE}" reference_sizes )
+
+# load the baseline
+set( baseline_found FALSE )
+
+if( NOT UPDATE_BASELINE AND EXISTS "${BASELINE}" )
+    set( baseline_found TRUE )
+
+    file( STRINGS "${BASELINE}" baseline_lines )
+
+    foreach( line ${baseline_lines} )
+        if( line MATCHES "^([^,]+),([0-9]+),([0-9]+),([0-9]+)$" )
+            set( "baseline_${CMAKE_MATCH_1}" "${CMAKE_MATCH_2};${CMAKE_MATCH_3};${CMAKE_MATCH_4}" )
+        endif( line MATCHES "^([^,]+),([0-9]+),([0-9]+),([0-9]+)$" )
+    endforeach( line ${baseline_lines} )
+endif( NOT UPDATE_BASELINE AND EXISTS "${BASELINE}" )
+
+# generate the report, each driver's size is its program's size less the reference
+# program's size
+set( report "driver,text,data,bss\n" )
+set( regressions "" )
+
+string( REPLACE "," ";" entries "${ENTRIES}" )
+
+foreach( entry ${entries} )
+    if( NOT entry MATCHES "^([^=]+)=(.+)$" )
+        message( FATAL_ERROR "malformed entry: ${entry}" )
+    endif( NOT entry MATCHES "^([^=]+)=(.+)$" )
+
+    set( driver "${CMAKE_MATCH_1}" )
+
+    get_section_sizes( "${CMAKE_MATCH_2}" program_sizes )
+
+    set( driver_sizes "" )
+    foreach( index RANGE 2 )
+        list( GET program_sizes   ${index} program_size )
+        list( GET reference_sizes ${index} reference_size )
+
+        math( EXPR driver_size "${program_size} - ${reference_size}" )
+
+        list( APPEND driver_sizes ${driver_size} )
+    endforeach( index RANGE 2 )
+
+    string( REPLACE ";" "," driver_sizes_csv "${driver_sizes}" )
+    string( APPEND report "${driver},${driver_sizes_csv}\n" )
+
+    if( baseline_found )
+        if( NOT DEFINED "baseline_${driver}" )
+            message( WARNING "${driver} has no baseline" )
+        else( NOT DEFINED "baseline_${driver}" )
+            foreach( index RANGE 2 )
+                list( GET SECTIONS              ${index} section )
+                list( GET driver_sizes          ${index} driver_size )
+                list( GET "baseline_${driver}"  ${index} baseline_size )
+
+                if( driver_size GREATER baseline_size )
+                    string( APPEND regressions "    ${driver} .${section}: ${baseline_size} -> ${driver_size}\n" )
+                endif( driver_size GREATER baseline_size )
+            endforeach( index RANGE 2 )
+        endif( NOT DEFINED "baseline_${driver}" )
+    endif( baseline_found )
+endforeach( entry ${entries} )
+
+message( "${report}" )
+
+if( UPDATE_BASELINE )
+    file( WRITE "${BASELINE}" "${report}" )
+
+    message( STATUS "baseline updated: ${BASELINE}" )
+elseif( NOT baseline_found )
+    message( FATAL_ERROR "baseline not found: ${BASELINE}\nbuild the picolibrary-microchip-megaavr0-size-report-update-baseline target to generate it" )
+elseif( regressions )
+    message( FATAL_ERROR "driver(s) grew past the baseline (${BASELINE}):\n${regressions}" )
+endif( UPDATE_BASELINE )
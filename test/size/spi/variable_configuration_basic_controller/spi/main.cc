@@ -0,0 +1,80 @@
+/**
+ * picolibrary-microchip-megaavr0
+ *
+ * Copyright 2021-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr0 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR0::SPI::Variable_Configuration_Basic_Controller<picolibrary::Microchip::megaAVR0::Peripheral::SPI>
+ *        size report program.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr0/multiplexed_signals.h"
+#include "picolibrary/microchip/megaavr0/peripheral.h"
+#include "picolibrary/microchip/megaavr0/spi.h"
+
+namespace {
+
+using ::picolibrary::Microchip::megaAVR0::Multiplexed_Signals::SPI_Route;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Bit_Order;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Clock_Phase;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Clock_Polarity;
+using ::picolibrary::Microchip::megaAVR0::SPI::SPI_Clock_Rate;
+using ::picolibrary::Microchip::megaAVR0::SPI::Variable_Configuration_Basic_Controller;
+
+using namespace ::picolibrary::Microchip::megaAVR0::Peripheral;
+
+/**
+ * \brief Driver input (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile input;
+
+/**
+ * \brief Driver output (volatile to prevent the driver operations being optimized away).
+ */
+std::uint8_t volatile output;
+
+} // namespace
+
+/**
+ * \brief Execute the
+ *        picolibrary::Microchip::megaAVR0::SPI::Variable_Configuration_Basic_Controller<picolibrary::Microchip::megaAVR0::Peripheral::SPI>
+ *        size report program.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    using Controller = Variable_Configuration_Basic_Controller<SPI>;
+
+    auto controller = Controller{ SPI0::instance(), SPI_Route::DEFAULT };
+
+    auto const configuration = Controller::Configuration{
+        SPI_Clock_Rate::CLK_PER_2,
+        SPI_Clock_Polarity::IDLE_LOW,
+        SPI_Clock_Phase::CAPTURE_IDLE_TO_ACTIVE,
+        SPI_Bit_Order::MSB_FIRST
+    };
+
+    controller.initialize();
+
+    for ( ;; ) {
+        controller.configure( configuration );
+
+        output = controller.exchange( input );
+    } // for
+}